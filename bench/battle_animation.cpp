@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <lcf/rpg/animation.h>
+#include "battle_animation.h"
+#include "bitmap.h"
+#include "drawable_list.h"
+#include "drawable_mgr.h"
+#include "pixel_format.h"
+
+namespace {
+	class BenchAnimation : public BattleAnimation {
+		public:
+			explicit BenchAnimation(const lcf::rpg::Animation& anim) : BattleAnimation(anim) {}
+			void Draw(Bitmap& dst) override { DrawAt(dst, 160, 120); }
+		protected:
+			void FlashTargets(int, int, int, int) override {}
+			void ShakeTargets(int, int, int) override {}
+	};
+
+	/** 2k3 skill animation: 20 frames with 12 toned, zoomed and translucent cells each */
+	lcf::rpg::Animation MakeAnimation() {
+		lcf::rpg::Animation anim;
+		anim.large = true;
+		for (int f = 0; f < 20; ++f) {
+			lcf::rpg::AnimationFrame frame;
+			for (int c = 0; c < 12; ++c) {
+				lcf::rpg::AnimationCellData cell;
+				cell.cell_id = (f + c) % 15;
+				cell.x = (c % 4) * 30 - 45;
+				cell.y = (c / 4) * 30 - 30;
+				cell.zoom = 80 + (c % 3) * 20;
+				cell.tone_red = 100 + (c % 4) * 25;
+				cell.tone_green = 100;
+				cell.tone_blue = 100 - (c % 2) * 50;
+				cell.tone_gray = 100;
+				cell.transparency = (c % 3) * 20;
+				frame.cells.push_back(cell);
+			}
+			anim.frames.push_back(frame);
+		}
+		return anim;
+	}
+}
+
+static void BM_BattleAnimationDraw(benchmark::State& state) {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+	DrawableList list;
+	DrawableMgr::SetLocalList(&list);
+
+	auto anim = MakeAnimation();
+	BenchAnimation animation(anim);
+	animation.SetBitmap(Bitmap::Create(640, 384, Color(255, 128, 0, 255)));
+	animation.SetInvert(state.range(0) != 0);
+	auto dst = Bitmap::Create(320, 240);
+
+	for (auto _: state) {
+		animation.SetFrame((animation.GetFrame() + 1) % animation.GetFrames());
+		animation.Draw(*dst);
+	}
+
+	DrawableMgr::SetLocalList(nullptr);
+}
+
+BENCHMARK(BM_BattleAnimationDraw)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -1,9 +1,13 @@
 #include <cmath>
+#include <sstream>
+#include <vector>
+#include <zlib.h>
 #include <benchmark/benchmark.h>
 #include <rect.h>
 #include <bitmap.h>
 #include <pixel_format.h>
 #include <transform.h>
+#include <filesystem_stream.h>
 
 constexpr auto opacity_100 = Opacity::Opaque();
 constexpr auto opacity_0 = Opacity(0);
@@ -374,6 +378,77 @@ static void BM_EffectsBlit(benchmark::State& state) {
 
 BENCHMARK(BM_EffectsBlit);
 
+// Paletted XYZ image with a gradient
+static std::vector<uint8_t> MakeXYZ(int w, int h) {
+	std::vector<uint8_t> data(768 + w * h);
+	for (int i = 0; i < 768; ++i) {
+		data[i] = static_cast<uint8_t>(i);
+	}
+	for (int i = 0; i < w * h; ++i) {
+		data[768 + i] = static_cast<uint8_t>(i % w + i / w);
+	}
+
+	uLongf len = compressBound(data.size());
+	std::vector<uint8_t> out(8 + len);
+	compress(&out[8], &len, data.data(), data.size());
+	out.resize(8 + len);
+
+	const uint8_t header[8] = { 'X', 'Y', 'Z', '1',
+		static_cast<uint8_t>(w), static_cast<uint8_t>(w >> 8),
+		static_cast<uint8_t>(h), static_cast<uint8_t>(h >> 8) };
+	std::copy(header, header + 8, out.begin());
+	return out;
+}
+
+// RGB PNG image with a gradient
+static std::string MakePNG(int w, int h) {
+	auto bm = Bitmap::Create(w, h, false);
+	for (int y = 0; y < h; y += 8) {
+		bm->FillRect(Rect{0, y, w, 8}, Color(y % 256, 255 - y % 256, 128, 255));
+	}
+
+	// The stream owns the buffer
+	auto* sb = new std::stringbuf();
+	Filesystem_Stream::OutputStream os(sb, FilesystemView(), "bench.png");
+	bm->WritePNG(os);
+	os.flush();
+	return sb->str();
+}
+
+static void BM_LoadXYZ(benchmark::State& state) {
+	Bitmap::SetFormat(format);
+	const auto data = MakeXYZ(state.range(0), state.range(1));
+	for (auto _: state) {
+		auto bm = Bitmap::Create(data.data(), data.size(), true);
+		benchmark::DoNotOptimize(bm);
+	}
+}
+
+// Charset, picture
+BENCHMARK(BM_LoadXYZ)->Args({288, 256})->Args({640, 480});
+
+static void BM_LoadPNG(benchmark::State& state) {
+	Bitmap::SetFormat(format);
+	const auto data = MakePNG(state.range(0), state.range(1));
+	for (auto _: state) {
+		auto bm = Bitmap::Create(reinterpret_cast<const uint8_t*>(data.data()), data.size(), true);
+		benchmark::DoNotOptimize(bm);
+	}
+}
+
+BENCHMARK(BM_LoadPNG)->Args({288, 256})->Args({640, 480});
+
+static void BM_LoadPNGBGRA(benchmark::State& state) {
+	Bitmap::SetFormat(fmt_bgra);
+	const auto data = MakePNG(640, 480);
+	for (auto _: state) {
+		auto bm = Bitmap::Create(reinterpret_cast<const uint8_t*>(data.data()), data.size(), true);
+		benchmark::DoNotOptimize(bm);
+	}
+}
+
+BENCHMARK(BM_LoadPNGBGRA);
+
 
 
 BENCHMARK_MAIN();
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include "bitmap.h"
+#include "cache.h"
+#include "pixel_format.h"
+
+namespace {
+	void Setup() {
+		Bitmap::SetFormat(format_R8G8B8A8_a().format());
+		// Loads the dummy bitmaps into the cache, the benchmarks measure cache hits
+		Cache::Charset(CACHE_DEFAULT_BITMAP);
+		Cache::Tile(CACHE_DEFAULT_BITMAP, 10);
+	}
+}
+
+static void BM_CharsetByName(benchmark::State& state) {
+	Setup();
+	const std::string name = CACHE_DEFAULT_BITMAP;
+	for (auto _: state) {
+		auto bmp = Cache::Charset(name);
+		benchmark::DoNotOptimize(bmp);
+	}
+	Cache::Clear();
+}
+
+BENCHMARK(BM_CharsetByName);
+
+static void BM_CharsetByAssetId(benchmark::State& state) {
+	Setup();
+	const auto asset = Cache::Intern(CACHE_DEFAULT_BITMAP);
+	for (auto _: state) {
+		auto bmp = Cache::Charset(asset);
+		benchmark::DoNotOptimize(bmp);
+	}
+	Cache::Clear();
+}
+
+BENCHMARK(BM_CharsetByAssetId);
+
+static void BM_TileByName(benchmark::State& state) {
+	Setup();
+	const std::string name = CACHE_DEFAULT_BITMAP;
+	auto tile = Cache::Tile(name, 10);
+	for (auto _: state) {
+		auto bmp = Cache::Tile(name, 10);
+		benchmark::DoNotOptimize(bmp);
+	}
+	Cache::Clear();
+}
+
+BENCHMARK(BM_TileByName);
+
+static void BM_TileByAssetId(benchmark::State& state) {
+	Setup();
+	const auto asset = Cache::Intern(CACHE_DEFAULT_BITMAP);
+	auto tile = Cache::Tile(asset, 10);
+	for (auto _: state) {
+		auto bmp = Cache::Tile(asset, 10);
+		benchmark::DoNotOptimize(bmp);
+	}
+	Cache::Clear();
+}
+
+BENCHMARK(BM_TileByAssetId);
+
+static void BM_Intern(benchmark::State& state) {
+	const std::string name = "Chara1";
+	Cache::Intern(name);
+	for (auto _: state) {
+		auto asset = Cache::Intern(name);
+		benchmark::DoNotOptimize(asset);
+	}
+}
+
+BENCHMARK(BM_Intern);
+
+BENCHMARK_MAIN();
@@ -7,6 +7,8 @@
 #include <drawable_list.h>
 #include <drawable_mgr.h>
 #include <iostream>
+#include <cmath>
+#include <pixel_format.h>
 
 constexpr int num_sprites = 5000;
 
@@ -45,4 +47,49 @@ static void BM_DrawSortLocality(benchmark::State& state) {
 
 BENCHMARK(BM_DrawSortLocality);
 
+static BitmapRef CreateEffectSource() {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+	auto src = Bitmap::Create(64, 64, true);
+	src->FillRect(Rect(8, 8, 48, 48), Color(255, 128, 0, 255));
+	src->FillRect(Rect(24, 24, 16, 16), Color(0, 128, 255, 128));
+	return src;
+}
+
+static void BM_DrawRotate(benchmark::State& state) {
+	auto src = CreateEffectSource();
+	auto dest = Bitmap::Create(320, 240, false);
+	auto rect = src->GetRect();
+	double angle = 0.0;
+	for (auto _: state) {
+		dest->RotateZoomOpacityBlit(160, 120, 32, 32, *src, rect, angle, 2.0, 2.0, Opacity(state.range(0)));
+		angle += 0.1;
+	}
+}
+
+BENCHMARK(BM_DrawRotate)->Arg(255)->Arg(128);
+
+static void BM_DrawZoom(benchmark::State& state) {
+	auto src = CreateEffectSource();
+	auto dest = Bitmap::Create(320, 240, false);
+	auto rect = src->GetRect();
+	for (auto _: state) {
+		dest->ZoomOpacityBlit(160, 120, 32, 32, *src, rect, 3.0, 3.0, Opacity(state.range(0)));
+	}
+}
+
+BENCHMARK(BM_DrawZoom)->Arg(255)->Arg(128);
+
+static void BM_DrawWaver(benchmark::State& state) {
+	auto src = CreateEffectSource();
+	auto dest = Bitmap::Create(320, 240, false);
+	auto rect = src->GetRect();
+	double phase = 0.0;
+	for (auto _: state) {
+		dest->WaverBlit(96, 56, 2.0, 2.0, *src, rect, 4, phase, Opacity(state.range(0)));
+		phase += 0.1;
+	}
+}
+
+BENCHMARK(BM_DrawWaver)->Arg(255)->Arg(128);
+
 BENCHMARK_MAIN();
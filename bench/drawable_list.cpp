@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <vector>
+#include "drawable.h"
+#include "drawable_list.h"
+#include "drawable_mgr.h"
+
+namespace {
+	class BenchSprite : public Drawable {
+		public:
+			BenchSprite() : Drawable(0, Drawable::Flags::Global) {}
+			void Draw(Bitmap&) override {}
+	};
+
+	// Z value of a map character, see Game_Character::GetScreenZ
+	Drawable::Z_t CharacterZ(int y) {
+		return Priority_Player + (static_cast<Drawable::Z_t>(y) << 32);
+	}
+}
+
+/** Crowd scene: state.range(0) characters of which every 4th walks vertically */
+static void BM_SortMovingSprites(benchmark::State& state) {
+	DrawableList default_list;
+	DrawableMgr::SetLocalList(&default_list);
+
+	const int num_sprites = state.range(0);
+	std::vector<BenchSprite> sprites(num_sprites);
+	std::vector<int> y(num_sprites);
+
+	DrawableList list;
+	for (int i = 0; i < num_sprites; ++i) {
+		y[i] = std::rand() % 240;
+		sprites[i].SetZ(CharacterZ(y[i]));
+		list.Append(&sprites[i]);
+	}
+	list.Sort();
+
+	for (auto _: state) {
+		for (int i = 0; i < num_sprites; i += 4) {
+			y[i] = (y[i] + ((i & 4) ? 1 : 239)) % 240;
+			sprites[i].SetZ(CharacterZ(y[i]));
+		}
+		list.Sort();
+	}
+
+	DrawableMgr::SetLocalList(nullptr);
+}
+
+BENCHMARK(BM_SortMovingSprites)->Arg(100)->Arg(500)->Arg(2000);
+
+/** Sorting a list without changes, e.g. a static scene marked dirty */
+static void BM_SortUnchanged(benchmark::State& state) {
+	DrawableList default_list;
+	DrawableMgr::SetLocalList(&default_list);
+
+	const int num_sprites = state.range(0);
+	std::vector<BenchSprite> sprites(num_sprites);
+
+	DrawableList list;
+	for (auto& sprite: sprites) {
+		sprite.SetZ(CharacterZ(std::rand() % 240));
+		list.Append(&sprite);
+	}
+	list.Sort();
+
+	for (auto _: state) {
+		list.SetDirty();
+		list.Sort();
+	}
+
+	DrawableMgr::SetLocalList(nullptr);
+}
+
+BENCHMARK(BM_SortUnchanged)->Arg(100)->Arg(500)->Arg(2000);
+
+BENCHMARK_MAIN();
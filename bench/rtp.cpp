@@ -1,7 +1,10 @@
 #include <benchmark/benchmark.h>
+#include <limits>
+#include "filefinder.h"
 #include "filefinder_rtp.h"
 #include "output.h"
 #include "player.h"
+#include "rtp.h"
 
 static void BM_InitRtp2k(benchmark::State& state) {
 	Output::SetLogLevel(LogLevel::Error);
@@ -35,4 +38,57 @@ static void BM_InitRtp2k3(benchmark::State& state) {
 
 BENCHMARK(BM_InitRtp2k3);
 
+static void BM_LookupAnyToRtpHit(benchmark::State& state) {
+	for (auto _: state) {
+		auto types = RTP::LookupAnyToRtp("charset", "monster2", 2000);
+		benchmark::DoNotOptimize(types);
+	}
+}
+
+BENCHMARK(BM_LookupAnyToRtpHit);
+
+static void BM_LookupAnyToRtpMiss(benchmark::State& state) {
+	for (auto _: state) {
+		auto types = RTP::LookupAnyToRtp("charset", "not_an_rtp_asset", 2003);
+		benchmark::DoNotOptimize(types);
+	}
+}
+
+BENCHMARK(BM_LookupAnyToRtpMiss);
+
+static void BM_LookupRtpToRtp(benchmark::State& state) {
+	bool is_rtp_asset;
+	for (auto _: state) {
+		auto name = RTP::LookupRtpToRtp("faceset", "主人公2", RTP::Type::RPG2003_OfficialJapanese, RTP::Type::RPG2003_OfficialEnglish, &is_rtp_asset);
+		benchmark::DoNotOptimize(name);
+	}
+}
+
+BENCHMARK(BM_LookupRtpToRtp);
+
+static void BM_LookupRtpToRtpMiss(benchmark::State& state) {
+	bool is_rtp_asset;
+	for (auto _: state) {
+		auto name = RTP::LookupRtpToRtp("sound", "not_an_rtp_asset", RTP::Type::RPG2003_OfficialJapanese, RTP::Type::RPG2003_OfficialEnglish, &is_rtp_asset);
+		benchmark::DoNotOptimize(name);
+	}
+}
+
+BENCHMARK(BM_LookupRtpToRtpMiss);
+
+static void BM_Detect(benchmark::State& state) {
+	Output::SetLogLevel(LogLevel::Error);
+
+	// Scans the whole table, the working directory is usually not an RTP
+	auto fs = FileFinder::Root().Create(".");
+	for (auto _: state) {
+		auto hits = RTP::Detect(fs, 0, std::numeric_limits<int>::max());
+		benchmark::DoNotOptimize(hits);
+	}
+
+	Output::SetLogLevel(LogLevel::Debug);
+}
+
+BENCHMARK(BM_Detect);
+
 BENCHMARK_MAIN();
@@ -74,3 +74,20 @@ for v in lookup.values():
 print("\t%s" % len(lines))
 print("};")
 print("")
+
+# For every RTP the row indices sorted by asset name inside every category
+# (rows without an asset last), used for binary searching the table
+ranges = list(lookup.values()) + [len(lines)]
+rtps = elems - 1
+sorted_rows = [[] for _ in range(rtps)]
+for j in range(rtps):
+	for start, end in zip(ranges, ranges[1:]):
+		rows = sorted(range(start, end), key=lambda r: (len(lines[r][j + 1]) == 0, lines[r][j + 1].encode("utf-8"), r))
+		sorted_rows[j].extend(rows)
+
+print("const int16_t rtp_table_2k%s_sorted[][%s] = {" % (rtp_table, rtps))
+for i in range(len(lines)):
+	print("\t{" + ", ".join(str(sorted_rows[j][i]) for j in range(rtps)) + "},")
+print("\t{" + ", ".join("-1" for j in range(rtps)) + "}")
+print("};")
+print("")
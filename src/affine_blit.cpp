@@ -0,0 +1,163 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "affine_blit.h"
+#include <algorithm>
+
+namespace {
+	constexpr uint32_t rb_mask = 0x00FF00FF;
+
+	/** Multiplies all four channels with a / 255, rounded like pixman */
+	inline uint32_t Mul(uint32_t x, uint32_t a) {
+		uint32_t rb = (x & rb_mask) * a + 0x00800080;
+		rb = ((rb + ((rb >> 8) & rb_mask)) >> 8) & rb_mask;
+
+		uint32_t ag = ((x >> 8) & rb_mask) * a + 0x00800080;
+		ag = (ag + ((ag >> 8) & rb_mask)) & ~rb_mask;
+
+		return rb | ag;
+	}
+
+	/** Adds all four channels, saturates at 255 */
+	inline uint32_t Add(uint32_t x, uint32_t y) {
+		uint32_t rb = (x & rb_mask) + (y & rb_mask);
+		rb |= 0x10000100 - ((rb >> 8) & rb_mask);
+
+		uint32_t ag = ((x >> 8) & rb_mask) + ((y >> 8) & rb_mask);
+		ag |= 0x10000100 - ((ag >> 8) & rb_mask);
+
+		return (rb & rb_mask) | ((ag & rb_mask) << 8);
+	}
+
+	template <AffineBlit::Op op, bool masked>
+	inline void Put(uint32_t& dst, uint32_t pixel, uint32_t opacity, int alpha_shift) {
+		if (masked) {
+			pixel = Mul(pixel, opacity);
+		}
+
+		if (op == AffineBlit::Op::Src) {
+			dst = pixel;
+			return;
+		}
+
+		// Premultiplied: a transparent pixel is 0
+		if (pixel == 0) {
+			return;
+		}
+
+		const uint32_t alpha = (pixel >> alpha_shift) & 0xFF;
+		dst = alpha == 0xFF ? pixel : Add(pixel, Mul(dst, 0xFF - alpha));
+	}
+
+	/** Position of the first pixel in the row as computed by pixman_transform_point */
+	inline int64_t RowStart(int32_t m0, int32_t m1, int32_t m2, int64_t px, int64_t py) {
+		const int64_t v = m0 * px + m1 * py + (static_cast<int64_t>(m2) << 16);
+		// Nearest sampling subtracts pixman_fixed_e to round pixel centres down
+		return ((v + 0x8000) >> 16) - 1;
+	}
+
+	template <AffineBlit::Op op, bool masked>
+	void BlitImpl(uint32_t* dst, int dst_pitch, const Rect& dst_rect,
+			const uint32_t* src, int src_pitch, int src_width, int src_height,
+			const AffineBlit::Mapping& m, uint32_t opacity, int alpha_shift) {
+		const bool scaled = (m.xy == 0 && m.yx == 0);
+		const int64_t px = (static_cast<int64_t>(dst_rect.x + m.offset_x) << 16) + 0x8000;
+
+		for (int y = dst_rect.y; y < dst_rect.y + dst_rect.height; ++y) {
+			uint32_t* dst_row = reinterpret_cast<uint32_t*>(reinterpret_cast<uint8_t*>(dst) + y * dst_pitch) + dst_rect.x;
+			const int64_t py = (static_cast<int64_t>(y + m.offset_y) << 16) + 0x8000;
+
+			int64_t vx = RowStart(m.xx, m.xy, m.tx, px, py);
+			int64_t vy = RowStart(m.yx, m.yy, m.ty, px, py);
+
+			if (scaled) {
+				// The source row is the same for the whole destination row
+				const int64_t sy = vy >> 16;
+				if (sy < 0 || sy >= src_height) {
+					if (op == AffineBlit::Op::Src) {
+						std::fill(dst_row, dst_row + dst_rect.width, 0);
+					}
+					continue;
+				}
+
+				const uint32_t* src_row = reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(src) + sy * src_pitch);
+				for (int x = 0; x < dst_rect.width; ++x, vx += m.xx) {
+					const int64_t sx = vx >> 16;
+					if (sx >= 0 && sx < src_width) {
+						Put<op, masked>(dst_row[x], src_row[sx], opacity, alpha_shift);
+					} else if (op == AffineBlit::Op::Src) {
+						dst_row[x] = 0;
+					}
+				}
+				continue;
+			}
+
+			for (int x = 0; x < dst_rect.width; ++x, vx += m.xx, vy += m.yx) {
+				const int64_t sx = vx >> 16;
+				const int64_t sy = vy >> 16;
+				if (sx >= 0 && sx < src_width && sy >= 0 && sy < src_height) {
+					const uint32_t* src_row = reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(src) + sy * src_pitch);
+					Put<op, masked>(dst_row[x], src_row[sx], opacity, alpha_shift);
+				} else if (op == AffineBlit::Op::Src) {
+					dst_row[x] = 0;
+				}
+			}
+		}
+	}
+}
+
+bool AffineBlit::FromTransform(const int32_t (&matrix)[3][3], int offset_x, int offset_y, Mapping& mapping) {
+	if (matrix[2][0] != 0 || matrix[2][1] != 0 || matrix[2][2] != (1 << 16)) {
+		return false;
+	}
+
+	mapping.xx = matrix[0][0];
+	mapping.xy = matrix[0][1];
+	mapping.tx = matrix[0][2];
+	mapping.yx = matrix[1][0];
+	mapping.yy = matrix[1][1];
+	mapping.ty = matrix[1][2];
+	mapping.offset_x = offset_x;
+	mapping.offset_y = offset_y;
+	return true;
+}
+
+void AffineBlit::Blit(uint32_t* dst, int dst_pitch, const Rect& dst_rect,
+		const uint32_t* src, int src_pitch, int src_width, int src_height,
+		const Mapping& mapping, int opacity, int alpha_shift, Op op) {
+	if (dst_rect.IsEmpty()) {
+		return;
+	}
+
+	const bool masked = opacity < 255;
+	const auto a = static_cast<uint32_t>(opacity);
+
+	if (op == Op::Src) {
+		if (masked) {
+			BlitImpl<Op::Src, true>(dst, dst_pitch, dst_rect, src, src_pitch, src_width, src_height, mapping, a, alpha_shift);
+		} else {
+			BlitImpl<Op::Src, false>(dst, dst_pitch, dst_rect, src, src_pitch, src_width, src_height, mapping, a, alpha_shift);
+		}
+	} else {
+		if (masked) {
+			BlitImpl<Op::Over, true>(dst, dst_pitch, dst_rect, src, src_pitch, src_width, src_height, mapping, a, alpha_shift);
+		} else {
+			BlitImpl<Op::Over, false>(dst, dst_pitch, dst_rect, src, src_pitch, src_width, src_height, mapping, a, alpha_shift);
+		}
+	}
+}
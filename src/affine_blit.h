@@ -0,0 +1,91 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_AFFINE_BLIT_H
+#define EP_AFFINE_BLIT_H
+
+// Headers
+#include <cstdint>
+#include "rect.h"
+
+/**
+ * Nearest neighbour blits of transformed (zoomed, rotated) images.
+ *
+ * Handles the common case of the sprite effects without pixman: 32 bit
+ * premultiplied pixels, a uniform opacity and the SRC or OVER operator.
+ * The pixels are sampled like pixman does with the nearest filter, so
+ * both produce the same image. Two color channels are processed per
+ * integer operation.
+ */
+namespace AffineBlit {
+	/**
+	 * Affine mapping of destination pixels to source pixels in 16.16 fixed
+	 * point, the layout of the first two rows of a pixman transform.
+	 * The centre of a destination pixel (x + offset_x, y + offset_y)
+	 * is transformed, the sampled source pixel contains the result.
+	 */
+	struct Mapping {
+		int32_t xx = 1 << 16;
+		int32_t xy = 0;
+		int32_t tx = 0;
+		int32_t yx = 0;
+		int32_t yy = 1 << 16;
+		int32_t ty = 0;
+		int offset_x = 0;
+		int offset_y = 0;
+	};
+
+	enum class Op {
+		/** Replaces the destination, pixels outside of the source become transparent */
+		Src,
+		/** Blends the source over the destination */
+		Over
+	};
+
+	/**
+	 * Creates the mapping of a pixman composite with an affine transform
+	 * of the source image.
+	 *
+	 * @param matrix 3x3 pixman transform in 16.16 fixed point
+	 * @param offset_x source x of the composite minus destination x
+	 * @param offset_y source y of the composite minus destination y
+	 * @param mapping receives the mapping
+	 * @return false when the transform is not affine
+	 */
+	bool FromTransform(const int32_t (&matrix)[3][3], int offset_x, int offset_y, Mapping& mapping);
+
+	/**
+	 * Draws the source into a rectangle of the destination.
+	 *
+	 * @param dst destination pixels
+	 * @param dst_pitch destination bytes per row
+	 * @param dst_rect destination rectangle, must be inside of the destination
+	 * @param src source pixels
+	 * @param src_pitch source bytes per row
+	 * @param src_width source width, pixels outside are transparent
+	 * @param src_height source height
+	 * @param mapping destination to source mapping
+	 * @param opacity uniform opacity (0 - 255)
+	 * @param alpha_shift bit position of the alpha channel
+	 * @param op blend operator
+	 */
+	void Blit(uint32_t* dst, int dst_pitch, const Rect& dst_rect,
+		const uint32_t* src, int src_pitch, int src_width, int src_height,
+		const Mapping& mapping, int opacity, int alpha_shift, Op op);
+}
+
+#endif
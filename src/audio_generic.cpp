@@ -24,6 +24,7 @@
 #include "audio_generic.h"
 #include "audio_generic_midiout.h"
 #include "filefinder.h"
+#include "instrumentation.h"
 #include "output.h"
 
 GenericAudio::BgmChannel GenericAudio::BGM_Channels[nr_of_bgm_channels];
@@ -296,6 +297,8 @@ bool GenericAudio::PlayOnChannel(SeChannel& chan, std::unique_ptr<AudioSeCache>
 }
 
 void GenericAudio::Decode(uint8_t* output_buffer, int buffer_length) {
+	Instrumentation::ZoneScope zone("GenericAudio::Decode");
+
 	bool channel_active = false;
 	float total_volume = 0;
 	int samples_per_frame = buffer_length / output_format.channels / 2;
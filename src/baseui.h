@@ -216,6 +216,16 @@ public:
 	 */
 	void SetFrameLimit(int fps_limit);
 
+	/** @return number of threads used for drawing the screen */
+	int GetRenderThreads() const;
+
+	/**
+	 * Sets the number of threads used for drawing the screen.
+	 *
+	 * @param threads number of threads, 1 draws sequentially
+	 */
+	void SetRenderThreads(int threads);
+
 	/** Sets the scaling mode of the window */
 	virtual void SetScalingMode(ScalingMode) {};
 
@@ -395,4 +405,12 @@ inline void BaseUi::SetFrameLimit(int fps_limit) {
 	frame_limit = (fps_limit == 0 ? Game_Clock::duration(0) : Game_Clock::TimeStepFromFps(fps_limit));
 }
 
+inline int BaseUi::GetRenderThreads() const {
+	return vcfg.render_threads.Get();
+}
+
+inline void BaseUi::SetRenderThreads(int threads) {
+	vcfg.render_threads.Set(threads);
+}
+
 #endif
@@ -82,55 +82,84 @@ void BattleAnimation::OnBattleSpriteReady(FileRequestResult* result) {
 	BitmapRef bitmap = Cache::Battle(result->file);
 	SetBitmap(bitmap);
 	SetSrcRect(Rect(0, 0, 0, 0));
+	cell_cache.clear();
 }
 
 void BattleAnimation::OnBattle2SpriteReady(FileRequestResult* result) {
 	BitmapRef bitmap = Cache::Battle2(result->file);
 	SetBitmap(bitmap);
 	SetSrcRect(Rect(0, 0, 0, 0));
+	cell_cache.clear();
+}
+
+const Bitmap& BattleAnimation::GetCellBitmap(int cell_id, const Rect& rect, const Tone& tone) {
+	// Cell tones are in range 0-256 (0-200%), 9 bits per component
+	uint64_t key = static_cast<uint64_t>(cell_id) << 37
+		| static_cast<uint64_t>(tone.red & 0x1FF) << 28
+		| static_cast<uint64_t>(tone.green & 0x1FF) << 19
+		| static_cast<uint64_t>(tone.blue & 0x1FF) << 10
+		| static_cast<uint64_t>(tone.gray & 0x1FF) << 1
+		| (invert ? 1 : 0);
+
+	auto& cell = cell_cache[key];
+	if (!cell) {
+		Cache::SpriteEffect(cell, *GetBitmap(), rect, invert, false, tone, Color());
+	}
+	return *cell;
 }
 
 void BattleAnimation::DrawAt(Bitmap& dst, int x, int y) {
-	if (IsDone()) {
+	if (IsDone() || !GetBitmap()) {
 		return;
 	}
 
+	const Bitmap& sheet = *GetBitmap();
 	const lcf::rpg::AnimationFrame& anim_frame = animation.frames[GetRealFrame()];
+	const int size = GetAnimationCellWidth();
+	const Color flash = GetFlashEffect();
 
-	std::vector<lcf::rpg::AnimationCellData>::const_iterator it;
-	for (it = anim_frame.cells.begin(); it != anim_frame.cells.end(); ++it) {
-		const lcf::rpg::AnimationCellData& cell = *it;
+	if (flash.alpha != 0 && cell_flash_scratch.size() < anim_frame.cells.size()) {
+		cell_flash_scratch.resize(anim_frame.cells.size());
+	}
 
+	for (size_t i = 0; i < anim_frame.cells.size(); ++i) {
+		const lcf::rpg::AnimationCellData& cell = anim_frame.cells[i];
 		if (!cell.valid) {
 			// Skip unused cells (they are created by deleting cells in the
 			// animation editor, resulting in gaps)
 			continue;
 		}
 
-		SetX(invert ? x - cell.x : cell.x + x);
-		SetY(cell.y + y);
-		int sx = cell.cell_id % 5;
-		if (invert) sx = 4 - sx;
-		int sy = cell.cell_id / 5;
-		int size = animation.large ? 128 : 96;
-		SetSrcRect(Rect(sx * size, sy * size, size, size));
-		SetOx(size / 2);
-		SetOy(size / 2);
-		SetTone(Tone(cell.tone_red * 128 / 100,
+		// Inverted cells are mirrored individually: Flipping the cell is the
+		// same as taking the mirrored column of the flipped sheet
+		Rect rect(cell.cell_id % 5 * size, cell.cell_id / 5 * size, size, size);
+		rect.Adjust(sheet.GetWidth(), sheet.GetHeight());
+		if (rect.IsEmpty()) {
+			continue;
+		}
+
+		Tone tone(cell.tone_red * 128 / 100,
 			cell.tone_green * 128 / 100,
 			cell.tone_blue * 128 / 100,
-			cell.tone_gray * 128 / 100));
-		SetOpacity(255 * (100 - cell.transparency) / 100);
-		SetZoomX(cell.zoom / 100.0);
-		SetZoomY(cell.zoom / 100.0);
-		SetFlipX(invert);
-		Sprite::Draw(dst);
-	}
+			cell.tone_gray * 128 / 100);
+
+		const Bitmap* cell_bitmap = &sheet;
+		Rect cell_rect = rect;
+		if (flash.alpha != 0) {
+			auto& scratch = cell_flash_scratch[i];
+			Cache::SpriteEffect(scratch, sheet, rect, invert, false, tone, flash);
+			cell_bitmap = scratch.get();
+			cell_rect = scratch->GetRect();
+		} else if (tone != Tone() || invert) {
+			cell_bitmap = &GetCellBitmap(cell.cell_id, rect, tone);
+			cell_rect = cell_bitmap->GetRect();
+		}
 
-	if (anim_frame.cells.empty()) {
-		// Draw an empty sprite when no cell is available in the animation
-		SetSrcRect(Rect(0, 0, 0, 0));
-		Sprite::Draw(dst);
+		const double zoom = cell.zoom / 100.0;
+		dst.EffectsBlit(invert ? x - cell.x : cell.x + x, cell.y + y, size / 2, size / 2,
+			*cell_bitmap, cell_rect,
+			Opacity(255 * (100 - cell.transparency) / 100),
+			zoom, zoom, 0.0, 0, 0.0);
 	}
 }
 
@@ -25,6 +25,8 @@
 #include <lcf/rpg/animation.h>
 #include "drawable.h"
 #include "sprite_battler.h"
+#include <unordered_map>
+#include <vector>
 
 struct FileRequestResult;
 
@@ -93,6 +95,17 @@ protected:
 	virtual void UpdateTargetFlash();
 	void UpdateFlashGeneric(int timing_idx, int& r, int& g, int& b, int& p);
 
+	/**
+	 * Returns a cell of the animation sheet with tone and flip applied.
+	 * The cells are rendered on first use and kept for the lifetime of the animation.
+	 *
+	 * @param cell_id cell of the animation sheet
+	 * @param rect rect of the cell in the animation sheet
+	 * @param tone tone of the cell
+	 * @return toned and flipped cell
+	 */
+	const Bitmap& GetCellBitmap(int cell_id, const Rect& rect, const Tone& tone);
+
 	const lcf::rpg::Animation& animation;
 	int frame = 0;
 	int num_frames = 0;
@@ -102,6 +115,15 @@ protected:
 	FileRequestBinding request_id;
 	bool only_sound = false;
 	bool invert = false;
+
+	/** Rendered cells, key is cell id, tone and invert */
+	std::unordered_map<uint64_t, BitmapRef> cell_cache;
+	/**
+	 * Reused for cells drawn during a flash, the flash changes every frame.
+	 * One per cell index, with RenderThreads the blits of all cells are
+	 * deferred and must not share a source.
+	 */
+	std::vector<BitmapRef> cell_flash_scratch;
 };
 
 // For playing animations on the map.
@@ -0,0 +1,266 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "battle_simulator.h"
+#include "autobattle.h"
+#include "enemyai.h"
+#include "game_actor.h"
+#include "game_actors.h"
+#include "game_battle.h"
+#include "game_battlealgorithm.h"
+#include "game_enemy.h"
+#include "game_enemyparty.h"
+#include "game_party.h"
+#include "game_switches.h"
+#include "game_system.h"
+#include "game_variables.h"
+#include "main_data.h"
+#include "output.h"
+#include "player.h"
+#include "rand.h"
+#include <algorithm>
+#include <lcf/data.h>
+#include <lcf/reader_util.h>
+#include <lcf/rpg/state.h>
+
+double BattleSimulator::Result::GetAverageTurns() const {
+	return battles > 0 ? static_cast<double>(turns) / battles : 0.0;
+}
+
+double BattleSimulator::Result::GetBattlesPerSecond() const {
+	const auto secs = std::chrono::duration<double>(elapsed).count();
+	return secs > 0.0 ? battles / secs : 0.0;
+}
+
+BattleSimulator::BattleSimulator(Config config) : config(std::move(config)) {
+	autobattle_algo = AutoBattle::CreateAlgorithm(this->config.autobattle_algo);
+	enemyai_algo = EnemyAi::CreateAlgorithm(this->config.enemyai_algo);
+}
+
+BattleSimulator::~BattleSimulator() = default;
+
+BattleSimulator::Result BattleSimulator::Run() {
+	Result result;
+
+	if (!lcf::ReaderUtil::GetElement(lcf::Data::troops, config.troop_id)) {
+		Output::Warning("BattleSimulator: Invalid troop {}", config.troop_id);
+		return result;
+	}
+
+	Rand::SeedRandomNumberGenerator(config.seed);
+
+	const auto start = Game_Clock::now();
+
+	for (int i = 0; i < config.battles; ++i) {
+		SetupBattle();
+
+		int turns = 0;
+		switch (RunBattle(turns)) {
+			case Outcome::Victory:
+				++result.victories;
+				break;
+			case Outcome::Defeat:
+				++result.defeats;
+				break;
+			case Outcome::Aborted:
+				++result.aborted;
+				break;
+		}
+
+		result.turns += turns;
+		result.min_turns = (result.battles == 0) ? turns : std::min(result.min_turns, turns);
+		result.max_turns = std::max(result.max_turns, turns);
+		++result.battles;
+	}
+
+	result.elapsed = Game_Clock::now() - start;
+	result.actions = num_actions;
+
+	Game_Battle::battle_running = false;
+	battle_actions.clear();
+	Main_Data::Cleanup();
+
+	return result;
+}
+
+void BattleSimulator::SetupBattle() {
+	// The init order is important, actors add their equipment to the party
+	Main_Data::Cleanup();
+
+	Main_Data::game_switches = std::make_unique<Game_Switches>();
+	Main_Data::game_switches->SetLowerLimit(lcf::Data::switches.size());
+	if (Player::IsRPG2k3()) {
+		Main_Data::game_variables = std::make_unique<Game_Variables>(Game_Variables::min_2k3, Game_Variables::max_2k3);
+	} else {
+		Main_Data::game_variables = std::make_unique<Game_Variables>(Game_Variables::min_2k, Game_Variables::max_2k);
+	}
+	Main_Data::game_variables->SetLowerLimit(lcf::Data::variables.size());
+	Main_Data::game_actors = std::make_unique<Game_Actors>();
+	Main_Data::game_system = std::make_unique<Game_System>();
+	Main_Data::game_enemyparty = std::make_unique<Game_EnemyParty>();
+	Main_Data::game_party = std::make_unique<Game_Party>();
+
+	Main_Data::game_party->SetupNewGame();
+	if (!config.party.empty()) {
+		Main_Data::game_party->Clear();
+		for (int actor_id: config.party) {
+			Main_Data::game_party->AddActor(actor_id);
+		}
+	}
+
+	Main_Data::game_party->ResetTurns();
+	Main_Data::game_enemyparty->ResetBattle(config.troop_id);
+	Main_Data::game_actors->ResetBattle();
+	for (auto* actor: Main_Data::game_party->GetActors()) {
+		actor->ResetEquipmentStates(true);
+	}
+
+	Game_Battle::battle_running = true;
+	battle_actions.clear();
+}
+
+BattleSimulator::Outcome BattleSimulator::RunBattle(int& turns) {
+	for (turns = 0; turns < config.max_turns; ++turns) {
+		Main_Data::game_party->IncTurns();
+		CreateActions();
+
+		for (auto* battler: battle_actions) {
+			// Same check order as Scene_Battle_Rpg2k: Battle end is tested before every action.
+			// The current turn counts as played.
+			if (Game_Battle::CheckLose()) {
+				++turns;
+				return Outcome::Defeat;
+			}
+			if (Game_Battle::CheckWin()) {
+				++turns;
+				return Outcome::Victory;
+			}
+
+			if (battler->Exists()) {
+				ExecuteAction(*battler);
+			}
+			battler->SetBattleAlgorithm(nullptr);
+		}
+		battle_actions.clear();
+
+		if (Game_Battle::CheckLose()) {
+			++turns;
+			return Outcome::Defeat;
+		}
+		if (Game_Battle::CheckWin()) {
+			++turns;
+			return Outcome::Victory;
+		}
+	}
+
+	return Outcome::Aborted;
+}
+
+void BattleSimulator::CreateActions() {
+	for (auto* actor: Main_Data::game_party->GetActors()) {
+		if (!actor->CanAct()) {
+			actor->SetBattleAlgorithm(std::make_shared<Game_BattleAlgorithm::None>(actor));
+		} else {
+			Game_Battler* random_target = nullptr;
+			switch (actor->GetSignificantRestriction()) {
+				case lcf::rpg::State::Restriction_attack_ally:
+					random_target = Main_Data::game_party->GetRandomActiveBattler();
+					break;
+				case lcf::rpg::State::Restriction_attack_enemy:
+					random_target = Main_Data::game_enemyparty->GetRandomActiveBattler();
+					break;
+				default:
+					break;
+			}
+
+			if (random_target) {
+				actor->SetBattleAlgorithm(std::make_shared<Game_BattleAlgorithm::Normal>(actor, random_target));
+			} else {
+				autobattle_algo->SetAutoBattleAction(*actor);
+			}
+		}
+		battle_actions.push_back(actor);
+	}
+
+	for (auto* enemy: Main_Data::game_enemyparty->GetEnemies()) {
+		if (!EnemyAi::SetStateRestrictedAction(*enemy)) {
+			enemyai_algo->SetEnemyAiAction(*enemy);
+		}
+		battle_actions.push_back(enemy);
+	}
+
+	// Same execution order as Scene_Battle_Rpg2k::CreateExecutionOrder
+	for (auto* battler: battle_actions) {
+		int battle_order = battler->GetAgi() + Rand::GetRandomNumber(0, battler->GetAgi() / 4 + 3);
+		if (battler->GetBattleAlgorithm()->GetType() == Game_BattleAlgorithm::Type::Normal && battler->HasPreemptiveAttack()) {
+			battle_order += 9999;
+		}
+		battler->SetBattleOrderAgi(battle_order);
+	}
+	std::sort(battle_actions.begin(), battle_actions.end(),
+			[](Game_Battler* l, Game_Battler* r) {
+			return l->GetBattleOrderAgi() > r->GetBattleOrderAgi();
+			});
+}
+
+void BattleSimulator::ExecuteAction(Game_Battler& battler) {
+	// Mirrors Scene_Battle::PrepareBattleAction
+	if (!battler.CanAct()) {
+		battler.SetBattleAlgorithm(std::make_shared<Game_BattleAlgorithm::None>(&battler));
+	} else if (battler.GetSignificantRestriction() == lcf::rpg::State::Restriction_attack_ally) {
+		Game_Battler* target = battler.GetType() == Game_Battler::Type_Enemy ?
+			Main_Data::game_enemyparty->GetRandomActiveBattler() :
+			Main_Data::game_party->GetRandomActiveBattler();
+		battler.SetBattleAlgorithm(std::make_shared<Game_BattleAlgorithm::Normal>(&battler, target));
+	} else if (battler.GetSignificantRestriction() == lcf::rpg::State::Restriction_attack_enemy) {
+		Game_Battler* target = battler.GetType() == Game_Battler::Type_Ally ?
+			Main_Data::game_enemyparty->GetRandomActiveBattler() :
+			Main_Data::game_party->GetRandomActiveBattler();
+		battler.SetBattleAlgorithm(std::make_shared<Game_BattleAlgorithm::Normal>(&battler, target));
+	} else if (!battler.GetBattleAlgorithm()->ActionIsPossible()) {
+		battler.SetBattleAlgorithm(std::make_shared<Game_BattleAlgorithm::None>(&battler));
+	}
+
+	// Keep the action alive, applying effects can reset the algorithm of the battler
+	auto action = battler.GetBattleAlgorithm();
+
+	battler.NextBattleTurn();
+	battler.BattleStateHeal();
+	battler.ApplyConditions();
+
+	++num_actions;
+
+	if (action->GetType() == Game_BattleAlgorithm::Type::None) {
+		return;
+	}
+
+	action->Start();
+	action->ReflectTargets();
+
+	do {
+		action->Execute();
+		if (action->IsSuccess() && action->GetTarget()) {
+			action->ApplyAll();
+		} else {
+			action->ApplyCustomEffect();
+			action->ApplySwitchEffect();
+		}
+	} while (action->RepeatNext(true) || action->TargetNext());
+
+	action->ProcessPostActionSwitches();
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_BATTLE_SIMULATOR_H
+#define EP_BATTLE_SIMULATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "game_clock.h"
+
+class Game_Battler;
+
+namespace AutoBattle {
+class AlgorithmBase;
+}
+
+namespace EnemyAi {
+class AlgorithmBase;
+}
+
+/**
+ * Runs battles between the party and a troop without any scene, window or
+ * sprite. Both sides are controlled by the AI (AutoBattle for the party,
+ * EnemyAi for the troop) and the actions are resolved by Game_BattleAlgorithm
+ * in the order of the RPG Maker 2000 battle system.
+ *
+ * Troop event pages are not executed and no animations are played.
+ *
+ * The simulation operates on the global game state (lcf::Data, Main_Data, Rand),
+ * so only one simulator can run per process. The database must be loaded
+ * before calling Run.
+ */
+class BattleSimulator {
+public:
+	struct Config {
+		/** Troop to fight against */
+		int troop_id = 1;
+		/** Actor ids of the party, when empty the initial party of the database is used */
+		std::vector<int> party;
+		/** Number of battles to simulate */
+		int battles = 1000;
+		/** Battles running longer than this number of turns are aborted */
+		int max_turns = 100;
+		/** Seed of the random number generator */
+		int32_t seed = 0;
+		/** AutoBattle algorithm used by the party */
+		std::string autobattle_algo;
+		/** EnemyAi algorithm used by the troop */
+		std::string enemyai_algo;
+	};
+
+	struct Result {
+		int battles = 0;
+		int victories = 0;
+		int defeats = 0;
+		int aborted = 0;
+		int64_t turns = 0;
+		int min_turns = 0;
+		int max_turns = 0;
+		int64_t actions = 0;
+		Game_Clock::duration elapsed = {};
+
+		/** @return average number of turns per battle */
+		double GetAverageTurns() const;
+
+		/** @return simulated battles per second */
+		double GetBattlesPerSecond() const;
+	};
+
+	explicit BattleSimulator(Config config);
+	~BattleSimulator();
+
+	/**
+	 * Simulates all battles.
+	 *
+	 * @return statistics about the simulated battles
+	 */
+	Result Run();
+
+private:
+	enum class Outcome {
+		Victory,
+		Defeat,
+		Aborted
+	};
+
+	void SetupBattle();
+	Outcome RunBattle(int& turns);
+	void CreateActions();
+	void ExecuteAction(Game_Battler& battler);
+
+	Config config;
+	std::unique_ptr<AutoBattle::AlgorithmBase> autobattle_algo;
+	std::unique_ptr<EnemyAi::AlgorithmBase> enemyai_algo;
+	std::vector<Game_Battler*> battle_actions;
+	int64_t num_actions = 0;
+};
+
+#endif
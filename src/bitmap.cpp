@@ -33,11 +33,16 @@
 #include "image_xyz.h"
 #include "image_bmp.h"
 #include "image_png.h"
+#include "image_cache.h"
+#include "instrumentation.h"
 #include "transform.h"
+#include "affine_blit.h"
 #include "font.h"
 #include "output.h"
 #include "util_macro.h"
 #include "bitmap_hslrgb.h"
+#include "compiler.h"
+#include "parallel_renderer.h"
 #include <iostream>
 
 BitmapRef Bitmap::Create(int width, int height, const Color& color) {
@@ -91,6 +96,8 @@ Bitmap::Bitmap(void *pixels, int width, int height, int pitch, const DynamicForm
 }
 
 Bitmap::Bitmap(Filesystem_Stream::InputStream stream, bool transparent, uint32_t flags) {
+	Instrumentation::ZoneScope zone("Bitmap::Load");
+
 	format = (transparent ? pixel_format : opaque_pixel_format);
 	pixman_format = find_format(format);
 
@@ -99,6 +106,21 @@ Bitmap::Bitmap(Filesystem_Stream::InputStream stream, bool transparent, uint32_t
 		return;
 	}
 
+	std::string cache_key;
+	if (ImageCache::IsEnabled()) {
+		auto encoded = Utils::ReadStream(stream);
+		cache_key = ImageCache::MakeKey(stream.GetName(), encoded, transparent, flags, format);
+
+		if (LoadCached(ImageCache::Read(cache_key), flags)) {
+			filename = ToString(stream.GetName());
+			return;
+		}
+
+		// Decode from the data that was already read
+		std::string name = ToString(stream.GetName());
+		stream = Filesystem_Stream::InputStream(new Filesystem_Stream::InputMemoryStreamBuf(std::move(encoded)), std::move(name));
+	}
+
 	int w = 0;
 	int h = 0;
 	void* pixels = nullptr;
@@ -131,6 +153,95 @@ Bitmap::Bitmap(Filesystem_Stream::InputStream stream, bool transparent, uint32_t
 	CheckPixels(flags);
 
 	filename = ToString(stream.GetName());
+
+	if (!cache_key.empty()) {
+		const auto cached = SaveCached(flags);
+		ImageCache::Write(cache_key, cached);
+	}
+}
+
+namespace {
+	struct CachedImageHeader {
+		int32_t width;
+		int32_t height;
+		int32_t pitch;
+		uint8_t image_opacity;
+		uint8_t bg_color[4];
+		uint8_t sh_color[4];
+	};
+}
+
+bool Bitmap::LoadCached(const std::vector<uint8_t>& data, uint32_t flags) {
+	CachedImageHeader header;
+	if (data.size() < sizeof(header)) {
+		return false;
+	}
+	memcpy(&header, data.data(), sizeof(header));
+
+	const int tiles = (flags & Flag_Chipset) ? (header.width / TILE_SIZE) * (header.height / TILE_SIZE) : 0;
+	if (header.width <= 0 || header.height <= 0 || header.pitch != header.width * format.bytes ||
+			data.size() != sizeof(header) + tiles + static_cast<size_t>(header.pitch) * header.height) {
+		return false;
+	}
+
+	Init(header.width, header.height, nullptr);
+	if (!bitmap) {
+		return false;
+	}
+
+	const uint8_t* src = data.data() + sizeof(header);
+
+	if (flags & Flag_Chipset) {
+		const int tw = header.width / TILE_SIZE;
+		const int th = header.height / TILE_SIZE;
+		tile_opacity = TileOpacity(tw, th);
+		for (int ty = 0; ty < th; ++ty) {
+			for (int tx = 0; tx < tw; ++tx) {
+				tile_opacity.Set(tx, ty, static_cast<ImageOpacity>(*src++));
+			}
+		}
+	}
+
+	for (int y = 0; y < header.height; ++y) {
+		memcpy(static_cast<uint8_t*>(pixels()) + y * pitch(), src, header.pitch);
+		src += header.pitch;
+	}
+
+	image_opacity = static_cast<ImageOpacity>(header.image_opacity);
+	bg_color = Color(header.bg_color[0], header.bg_color[1], header.bg_color[2], header.bg_color[3]);
+	sh_color = Color(header.sh_color[0], header.sh_color[1], header.sh_color[2], header.sh_color[3]);
+	read_only = (flags & Flag_ReadOnly) != 0;
+
+	return true;
+}
+
+std::vector<uint8_t> Bitmap::SaveCached(uint32_t flags) const {
+	CachedImageHeader header = {
+		width(), height(), width() * format.bytes,
+		static_cast<uint8_t>(image_opacity),
+		{ bg_color.red, bg_color.green, bg_color.blue, bg_color.alpha },
+		{ sh_color.red, sh_color.green, sh_color.blue, sh_color.alpha }
+	};
+
+	const int tw = (flags & Flag_Chipset) ? header.width / TILE_SIZE : 0;
+	const int th = (flags & Flag_Chipset) ? header.height / TILE_SIZE : 0;
+
+	std::vector<uint8_t> data(sizeof(header) + tw * th + static_cast<size_t>(header.pitch) * header.height);
+	memcpy(data.data(), &header, sizeof(header));
+
+	uint8_t* dst = data.data() + sizeof(header);
+	for (int ty = 0; ty < th; ++ty) {
+		for (int tx = 0; tx < tw; ++tx) {
+			*dst++ = static_cast<uint8_t>(tile_opacity.Get(tx, ty));
+		}
+	}
+
+	for (int y = 0; y < header.height; ++y) {
+		memcpy(dst, static_cast<const uint8_t*>(pixels()) + y * pitch(), header.pitch);
+		dst += header.pitch;
+	}
+
+	return data;
 }
 
 Bitmap::Bitmap(const uint8_t* data, unsigned bytes, bool transparent, uint32_t flags) {
@@ -173,19 +284,34 @@ Bitmap::Bitmap(Bitmap const& source, Rect const& src_rect, bool transparent) {
 	Blit(0, 0, source, src_rect, Opacity::Opaque());
 }
 
+Bitmap::~Bitmap() {
+	FlushPendingReads();
+}
+
+void Bitmap::FlushPendingReads() {
+	if (EP_UNLIKELY(pending_reader)) {
+		pending_reader->Flush();
+	}
+}
+
 bool Bitmap::WritePNG(Filesystem_Stream::OutputStream& os) const {
 	size_t const width = GetWidth(), height = GetHeight();
-	size_t const stride = width * 4;
 
 	std::vector<uint32_t> data(width * height);
-
-	auto dst = PixmanImagePtr{pixman_image_create_bits(PIXMAN_b8g8r8, width, height, &data.front(), stride)};
-	pixman_image_composite32(PIXMAN_OP_SRC, bitmap.get(), NULL, dst.get(),
-							 0, 0, 0, 0, 0, 0, width, height);
+	ReadPixelsRGB(&data.front());
 
 	return ImagePNG::WritePNG(os, width, height, &data.front());
 }
 
+void Bitmap::ReadPixelsRGB(uint32_t* dst) const {
+	size_t const width = GetWidth(), height = GetHeight();
+	size_t const stride = width * 4;
+
+	auto dst_img = PixmanImagePtr{pixman_image_create_bits(PIXMAN_b8g8r8, width, height, dst, stride)};
+	pixman_image_composite32(PIXMAN_OP_SRC, bitmap.get(), NULL, dst_img.get(),
+							 0, 0, 0, 0, 0, 0, width, height);
+}
+
 size_t Bitmap::GetSize() const {
 	if (!bitmap) {
 		return 0;
@@ -194,6 +320,20 @@ size_t Bitmap::GetSize() const {
 	return pitch() * height();
 }
 
+void Bitmap::SetClipRect(const Rect& rect) {
+	clip_rect = rect;
+
+	if (rect.IsEmpty()) {
+		pixman_image_set_clip_region32(bitmap.get(), nullptr);
+		return;
+	}
+
+	pixman_region32_t region;
+	pixman_region32_init_rect(&region, rect.x, rect.y, rect.width, rect.height);
+	pixman_image_set_clip_region32(bitmap.get(), &region);
+	pixman_region32_fini(&region);
+}
+
 ImageOpacity Bitmap::ComputeImageOpacity() const {
 	bool all_opaque = true;
 	bool all_transp = true;
@@ -285,6 +425,11 @@ void Bitmap::CheckPixels(uint32_t flags) {
 	}
 }
 
+void Bitmap::CheckTileOpacity(int x, int y) {
+	Rect rect(x * TILE_SIZE, y * TILE_SIZE, TILE_SIZE, TILE_SIZE);
+	tile_opacity.Set(x, y, ComputeImageOpacity(rect));
+}
+
 Color Bitmap::GetColorAt(int x, int y) const {
 	if (x < 0 || x >= width() || y < 0 || y >= height()) {
 		return {};
@@ -300,6 +445,9 @@ Color Bitmap::GetColorAt(int x, int y) const {
 }
 
 void Bitmap::HueChangeBlit(int x, int y, Bitmap const& src, Rect const& src_rect_, double hue_) {
+	// Draws from a temporary bitmap, this cannot be recorded
+	ParallelRenderer::Barrier barrier(*this);
+
 	Rect dst_rect(x, y, 0, 0), src_rect = src_rect_;
 
 	if (!Rect::AdjustRectangles(src_rect, dst_rect, src.GetRect()))
@@ -359,6 +507,9 @@ Point Bitmap::TextDraw(Rect const& rect, int color, StringView text, Text::Align
 }
 
 Point Bitmap::TextDraw(int x, int y, int color, StringView text, Text::Alignment align) {
+	// Glyphs are rendered into temporary bitmaps, this cannot be recorded
+	ParallelRenderer::Barrier barrier(*this);
+
 	auto font = Font::Default();
 	auto system = Cache::SystemOrBlack();
 	return Text::Draw(*this, x, y, *font, *system, color, text, align);
@@ -390,6 +541,8 @@ Point Bitmap::TextDraw(Rect const& rect, Color color, StringView text, Text::Ali
 }
 
 Point Bitmap::TextDraw(int x, int y, Color color, StringView text) {
+	ParallelRenderer::Barrier barrier(*this);
+
 	auto font = Font::Default();
 	return Text::Draw(*this, x, y, *font, color, text);
 }
@@ -530,7 +683,48 @@ void Bitmap::Init(int width, int height, void* data, int pitch, bool destroy) {
 		pixman_image_set_destroy_function(bitmap.get(), destroy_func, data);
 }
 
+namespace {
+	// (x * a) / 255 without a division, exact for x, a in [0, 255]
+	inline uint32_t MultiplyAlpha255(uint32_t x, uint32_t a) {
+		const uint32_t v = x * a;
+		return (v + 1 + (v >> 8)) >> 8;
+	}
+}
+
 void Bitmap::ConvertImage(int& width, int& height, void*& pixels, bool transparent) {
+	const bool direct = format.bits == 32 &&
+		format.r.bits == 8 && format.g.bits == 8 && format.b.bits == 8 &&
+		(format.a.bits == 8 || format.a.bits == 0);
+
+	if (direct) {
+		// Premultiply and convert in one pass into the bitmap.
+		// The loop is branch free so the compiler can vectorize it.
+		const int rs = format.r.shift;
+		const int gs = format.g.shift;
+		const int bs = format.b.shift;
+		const int as = format.a.shift;
+		const uint32_t alpha_mask = format.a.bits ? (transparent ? 0xFFu : 0u) << as : 0u;
+		const uint32_t alpha_fill = format.a.bits && !transparent ? 0xFFu << as : 0u;
+
+		for (int y = 0; y < height; y++) {
+			const uint8_t* src = (const uint8_t*) pixels + y * width * 4;
+			uint32_t* dst = (uint32_t*) ((uint8_t*) this->pixels() + y * pitch());
+			for (int x = 0; x < width; x++) {
+				const uint32_t r = src[x * 4];
+				const uint32_t g = src[x * 4 + 1];
+				const uint32_t b = src[x * 4 + 2];
+				const uint32_t a = src[x * 4 + 3];
+				dst[x] = (MultiplyAlpha255(r, a) << rs) |
+					(MultiplyAlpha255(g, a) << gs) |
+					(MultiplyAlpha255(b, a) << bs) |
+					((a << as) & alpha_mask) | alpha_fill;
+			}
+		}
+
+		free(pixels);
+		return;
+	}
+
 	const DynamicFormat& img_format = transparent ? image_format : opaque_image_format;
 
 	// premultiply alpha
@@ -607,6 +801,12 @@ namespace {
 } // anonymous namespace
 
 void Bitmap::Blit(int x, int y, Bitmap const& src, Rect const& src_rect, Opacity const& opacity, Bitmap::BlendMode blend_mode) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.Blit(x, y, src, src_rect, opacity, blend_mode); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -623,6 +823,12 @@ void Bitmap::Blit(int x, int y, Bitmap const& src, Rect const& src_rect, Opacity
 }
 
 void Bitmap::BlitFast(int x, int y, Bitmap const & src, Rect const & src_rect, Opacity const & opacity) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.BlitFast(x, y, src, src_rect, opacity); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -636,6 +842,12 @@ void Bitmap::BlitFast(int x, int y, Bitmap const & src, Rect const & src_rect, O
 		src_rect.width, src_rect.height);
 }
 
+PixmanImagePtr Bitmap::GetTransformableImage(Bitmap const& src) {
+	// A transform is state of the pixman image. Using a private image keeps
+	// concurrent blits of the same source (ParallelRenderer) independent.
+	return GetSubimage(src, src.GetRect());
+}
+
 PixmanImagePtr Bitmap::GetSubimage(Bitmap const& src, const Rect& src_rect) {
 	uint8_t* pixels = (uint8_t*) src.pixels() + src_rect.x * src.bpp() + src_rect.y * src.pitch();
 	return PixmanImagePtr{ pixman_image_create_bits(src.pixman_format, src_rect.width, src_rect.height,
@@ -647,6 +859,12 @@ void Bitmap::TiledBlit(Rect const& src_rect, Bitmap const& src, Rect const& dst_
 }
 
 void Bitmap::TiledBlit(int ox, int oy, Rect const& src_rect, Bitmap const& src, Rect const& dst_rect, Opacity const& opacity, Bitmap::BlendMode blend_mode) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.TiledBlit(ox, oy, src_rect, src, dst_rect, opacity, blend_mode); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -675,6 +893,12 @@ void Bitmap::StretchBlit(Bitmap const&  src, Rect const& src_rect, Opacity const
 }
 
 void Bitmap::StretchBlit(Rect const& dst_rect, Bitmap const& src, Rect const& src_rect, Opacity const& opacity, Bitmap::BlendMode blend_mode) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.StretchBlit(dst_rect, src, src_rect, opacity, blend_mode); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -684,30 +908,52 @@ void Bitmap::StretchBlit(Rect const& dst_rect, Bitmap const& src, Rect const& sr
 
 	Transform xform = Transform::Scale(zoom_x, zoom_y);
 
-	pixman_image_set_transform(src.bitmap.get(), &xform.matrix);
+	const auto op = src.SelectOperator(!opacity.IsOpaque(), blend_mode);
+	if (CanBlitAffine(src, xform, opacity, op)) {
+		BlitAffine(dst_rect, src, src.GetRect(), xform,
+			static_cast<int>(src_rect.x / zoom_x) - dst_rect.x,
+			static_cast<int>(src_rect.y / zoom_y) - dst_rect.y,
+			opacity, op);
+		return;
+	}
+
+	auto src_img = GetTransformableImage(src);
+	pixman_image_set_transform(src_img.get(), &xform.matrix);
 
 	auto mask = CreateMask(opacity, src_rect, &xform);
 
-	pixman_image_composite32(src.GetOperator(mask.get(), blend_mode),
-							 src.bitmap.get(), mask.get(), bitmap.get(),
+	pixman_image_composite32(op,
+							 src_img.get(), mask.get(), bitmap.get(),
 							 src_rect.x / zoom_x, src_rect.y / zoom_y,
 							 0, 0,
 							 dst_rect.x, dst_rect.y,
 							 dst_rect.width, dst_rect.height);
-
-	pixman_image_set_transform(src.bitmap.get(), nullptr);
 }
 
 void Bitmap::WaverBlit(int x, int y, double zoom_x, double zoom_y, Bitmap const& src, Rect const& src_rect, int depth, double phase, Opacity const& opacity, Bitmap::BlendMode blend_mode) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.WaverBlit(x, y, zoom_x, zoom_y, src, src_rect, depth, phase, opacity, blend_mode); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
 
 	Transform xform = Transform::Scale(1.0 / zoom_x, 1.0 / zoom_y);
 
-	pixman_image_set_transform(src.bitmap.get(), &xform.matrix);
+	const auto op = src.SelectOperator(!opacity.IsOpaque(), blend_mode);
+	const bool affine = CanBlitAffine(src, xform, opacity, op);
 
-	auto mask = CreateMask(opacity, src_rect, &xform);
+	PixmanImagePtr src_img;
+	PixmanImagePtr mask;
+	if (!affine) {
+		src_img = GetTransformableImage(src);
+		pixman_image_set_transform(src_img.get(), &xform.matrix);
+
+		mask = CreateMask(opacity, src_rect, &xform);
+	}
 
 	int height = static_cast<int>(std::floor(src_rect.height * zoom_y));
 	int width  = static_cast<int>(std::floor(src_rect.width * zoom_x));
@@ -723,15 +969,22 @@ void Bitmap::WaverBlit(int x, int y, double zoom_x, double zoom_y, Bitmap const&
 		const double sy = (i - yclip) * (2 * M_PI) / (32.0 * zoom_y);
 		const int offset = 2 * zoom_x * depth * std::sin(phase + sy);
 
-		pixman_image_composite32(src.GetOperator(mask.get(), blend_mode),
-								 src.bitmap.get(), mask.get(), bitmap.get(),
+		if (affine) {
+			// Same integer source origin as the pixman composite
+			BlitAffine(Rect(x + offset, dy, width, 1), src, src.GetRect(), xform,
+				static_cast<int>(xoff) - (x + offset),
+				static_cast<int>(yoff + i) - dy,
+				opacity, op);
+			continue;
+		}
+
+		pixman_image_composite32(op,
+								 src_img.get(), mask.get(), bitmap.get(),
 								 xoff, yoff + i,
 								 0, i,
 								 x + offset, dy,
 								 width, 1);
 	}
-
-	pixman_image_set_transform(src.bitmap.get(), nullptr);
 }
 
 static pixman_color_t PixmanColor(const Color &color) {
@@ -744,6 +997,12 @@ static pixman_color_t PixmanColor(const Color &color) {
 }
 
 void Bitmap::Fill(const Color &color) {
+	if (EP_UNLIKELY(recorder)) {
+		recorder->Record([=](Bitmap& dst) { dst.Fill(color); });
+		return;
+	}
+	FlushPendingReads();
+
 	pixman_color_t pcolor = PixmanColor(color);
 
 	pixman_box32_t box = { 0, 0, width(), height() };
@@ -752,6 +1011,12 @@ void Bitmap::Fill(const Color &color) {
 }
 
 void Bitmap::FillRect(Rect const& dst_rect, const Color &color) {
+	if (EP_UNLIKELY(recorder)) {
+		recorder->Record([=](Bitmap& dst) { dst.FillRect(dst_rect, color); });
+		return;
+	}
+	FlushPendingReads();
+
 	pixman_color_t pcolor = PixmanColor(color);
 
 	auto timage = PixmanImagePtr{pixman_image_create_solid_fill(&pcolor)};
@@ -765,6 +1030,8 @@ void Bitmap::FillRect(Rect const& dst_rect, const Color &color) {
 }
 
 void Bitmap::Clear() {
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (!pixels()) {
 		// Happens when height or width of bitmap are 0
 		return;
@@ -774,6 +1041,12 @@ void Bitmap::Clear() {
 }
 
 void Bitmap::ClearRect(Rect const& dst_rect) {
+	if (EP_UNLIKELY(recorder)) {
+		recorder->Record([=](Bitmap& dst) { dst.ClearRect(dst_rect); });
+		return;
+	}
+	FlushPendingReads();
+
 	pixman_color_t pcolor = {};
 	pixman_box32_t box = {
 		dst_rect.x,
@@ -852,6 +1125,9 @@ static inline void color_tone_alpha(uint32_t &src_pixel, const Tone& tone, const
 }
 
 void Bitmap::ToneBlit(int x, int y, Bitmap const& src, Rect const& src_rect, const Tone &tone, Opacity const& opacity) {
+	// Modifies the pixels directly, this cannot be clipped
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -1007,6 +1283,12 @@ void Bitmap::ToneBlit(int x, int y, Bitmap const& src, Rect const& src_rect, con
 }
 
 void Bitmap::BlendBlit(int x, int y, Bitmap const& src, Rect const& src_rect, const Color& color, Opacity const& opacity) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.BlendBlit(x, y, src, src_rect, color, opacity); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -1037,6 +1319,12 @@ void Bitmap::BlendBlit(int x, int y, Bitmap const& src, Rect const& src_rect, co
 }
 
 void Bitmap::FlipBlit(int x, int y, Bitmap const& src, Rect const& src_rect, bool horizontal, bool vertical, Opacity const& opacity, Bitmap::BlendMode blend_mode) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.FlipBlit(x, y, src, src_rect, horizontal, vertical, opacity, blend_mode); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent()) {
 		return;
 	}
@@ -1045,26 +1333,35 @@ void Bitmap::FlipBlit(int x, int y, Bitmap const& src, Rect const& src_rect, boo
 	const auto img_w = src.GetWidth();
 	const auto img_h = src.GetHeight();
 
-	auto rect = src_rect;
-	if (has_xform) {
-		Transform xform = Transform::Scale(horizontal ? -1 : 1, vertical ? -1 : 1);
-		xform *= Transform::Translation(horizontal ? -img_w : 0, vertical ? -img_h : 0);
+	if (!has_xform) {
+		Blit(x, y, src, src_rect, opacity, blend_mode);
+		return;
+	}
+
+	Transform xform = Transform::Scale(horizontal ? -1 : 1, vertical ? -1 : 1);
+	xform *= Transform::Translation(horizontal ? -img_w : 0, vertical ? -img_h : 0);
 
-		pixman_image_set_transform(src.bitmap.get(), &xform.matrix);
-		const auto src_x = horizontal ? img_w - src_rect.x - src_rect.width : src_rect.x;
-		const auto src_y = vertical ? img_h - src_rect.y - src_rect.height : src_rect.y;
+	auto src_img = GetTransformableImage(src);
+	pixman_image_set_transform(src_img.get(), &xform.matrix);
+	const auto src_x = horizontal ? img_w - src_rect.x - src_rect.width : src_rect.x;
+	const auto src_y = vertical ? img_h - src_rect.y - src_rect.height : src_rect.y;
 
-		rect = Rect{ src_x, src_y, src_rect.width, src_rect.height };
-	}
+	const auto rect = Rect{ src_x, src_y, src_rect.width, src_rect.height };
 
-	Blit(x, y, src, rect, opacity, blend_mode);
+	auto mask = CreateMask(opacity, rect);
 
-	if (has_xform) {
-		pixman_image_set_transform(src.bitmap.get(), nullptr);
-	}
+	pixman_image_composite32(src.GetOperator(mask.get(), blend_mode),
+							 src_img.get(),
+							 mask.get(), bitmap.get(),
+							 rect.x, rect.y,
+							 0, 0,
+							 x, y,
+							 rect.width, rect.height);
 }
 
 void Bitmap::Flip(bool horizontal, bool vertical) {
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (!horizontal && !vertical) {
 		return;
 	}
@@ -1089,6 +1386,12 @@ void Bitmap::Flip(bool horizontal, bool vertical) {
 }
 
 void Bitmap::MaskedBlit(Rect const& dst_rect, Bitmap const& mask, int mx, int my, Color const& color) {
+	if (EP_UNLIKELY(recorder) && &mask != this) {
+		recorder->Record([=, &mask](Bitmap& dst) { dst.MaskedBlit(dst_rect, mask, mx, my, color); }, mask);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	pixman_color_t tcolor = {
 		static_cast<uint16_t>(color.red << 8),
 		static_cast<uint16_t>(color.green << 8),
@@ -1106,6 +1409,12 @@ void Bitmap::MaskedBlit(Rect const& dst_rect, Bitmap const& mask, int mx, int my
 }
 
 void Bitmap::MaskedBlit(Rect const& dst_rect, Bitmap const& mask, int mx, int my, Bitmap const& src, int sx, int sy) {
+	if (EP_UNLIKELY(recorder) && &src != this && &mask != this) {
+		recorder->Record([=, &mask, &src](Bitmap& dst) { dst.MaskedBlit(dst_rect, mask, mx, my, src, sx, sy); }, src, mask);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	pixman_image_composite32(PIXMAN_OP_OVER,
 							 src.bitmap.get(), mask.bitmap.get(), bitmap.get(),
 							 sx, sy,
@@ -1115,18 +1424,23 @@ void Bitmap::MaskedBlit(Rect const& dst_rect, Bitmap const& mask, int mx, int my
 }
 
 void Bitmap::Blit2x(Rect const& dst_rect, Bitmap const& src, Rect const& src_rect) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.Blit2x(dst_rect, src, src_rect); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	Transform xform = Transform::Scale(0.5, 0.5);
 
-	pixman_image_set_transform(src.bitmap.get(), &xform.matrix);
+	auto src_img = GetTransformableImage(src);
+	pixman_image_set_transform(src_img.get(), &xform.matrix);
 
 	pixman_image_composite32(PIXMAN_OP_SRC,
-							 src.bitmap.get(), nullptr, bitmap.get(),
+							 src_img.get(), nullptr, bitmap.get(),
 							 src_rect.x, src_rect.y,
 							 0, 0,
 							 dst_rect.x, dst_rect.y,
 							 dst_rect.width, dst_rect.height);
-
-	pixman_image_set_transform(src.bitmap.get(), nullptr);
 }
 
 void Bitmap::EffectsBlit(int x, int y, int ox, int oy,
@@ -1161,11 +1475,15 @@ void Bitmap::RotateZoomOpacityBlit(int x, int y, int ox, int oy,
 		Bitmap const& src, Rect const& src_rect,
 		double angle, double zoom_x, double zoom_y, Opacity const& opacity, Bitmap::BlendMode blend_mode)
 {
-	if (opacity.IsTransparent()) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.RotateZoomOpacityBlit(x, y, ox, oy, src, src_rect, angle, zoom_x, zoom_y, opacity, blend_mode); }, src);
 		return;
 	}
+	ParallelRenderer::Barrier barrier(*this);
 
-	auto* src_img = src.bitmap.get();
+	if (opacity.IsTransparent()) {
+		return;
+	}
 
 	Transform fwd = Transform::Translation(x, y);
 	fwd *= Transform::Rotation(angle);
@@ -1181,26 +1499,29 @@ void Bitmap::RotateZoomOpacityBlit(int x, int y, int ox, int oy,
 
 	auto inv = fwd.Inverse();
 
-	PixmanImagePtr temp;
-	if (src_rect != src.GetRect()) {
-		temp = GetSubimage(src, src_rect);
-		src_img = temp.get();
+	// OP_SRC draws a black rectangle around the rotated image making this operator unusable here
+	blend_mode = (blend_mode == BlendMode::Default ? BlendMode::Normal : blend_mode);
+	const auto op = SelectOperator(!opacity.IsOpaque(), blend_mode);
+
+	if (CanBlitAffine(src, inv, opacity, op)) {
+		BlitAffine(dst_rect, src, src_rect, inv, 0, 0, opacity, op);
+		return;
 	}
 
+	// Always a private image, the transform must not be visible to other threads
+	auto temp = GetSubimage(src, src_rect);
+	auto* src_img = temp.get();
+
 	pixman_image_set_transform(src_img, &inv.matrix);
 
 	auto mask = CreateMask(opacity, src_rect, &inv);
 
-	// OP_SRC draws a black rectangle around the rotated image making this operator unusable here
-	blend_mode = (blend_mode == BlendMode::Default ? BlendMode::Normal : blend_mode);
-	pixman_image_composite32(GetOperator(mask.get(), blend_mode),
+	pixman_image_composite32(op,
 							 src_img, mask.get(), bitmap.get(),
 							 dst_rect.x, dst_rect.y,
 							 dst_rect.x, dst_rect.y,
 							 dst_rect.x, dst_rect.y,
 							 dst_rect.width, dst_rect.height);
-
-	pixman_image_set_transform(src_img, nullptr);
 }
 
 void Bitmap::ZoomOpacityBlit(int x, int y, int ox, int oy,
@@ -1221,6 +1542,10 @@ void Bitmap::ZoomOpacityBlit(int x, int y, int ox, int oy,
 }
 
 pixman_op_t Bitmap::GetOperator(pixman_image_t* mask, Bitmap::BlendMode blend_mode) const {
+	return SelectOperator(mask != nullptr, blend_mode);
+}
+
+pixman_op_t Bitmap::SelectOperator(bool has_mask, Bitmap::BlendMode blend_mode) const {
 	if (blend_mode != BlendMode::Default) {
 		switch (blend_mode) {
 			case BlendMode::Normal:
@@ -1258,14 +1583,67 @@ pixman_op_t Bitmap::GetOperator(pixman_image_t* mask, Bitmap::BlendMode blend_mo
 		}
 	}
 
-	if (!mask && (!GetTransparent() || GetImageOpacity() == ImageOpacity::Opaque)) {
+	if (!has_mask && (!GetTransparent() || GetImageOpacity() == ImageOpacity::Opaque)) {
 		return PIXMAN_OP_SRC;
 	}
 
 	return PIXMAN_OP_OVER;
 }
 
+bool Bitmap::CanBlitAffine(Bitmap const& src, Transform const& xform, Opacity const& opacity, pixman_op_t op) const {
+	if (op != PIXMAN_OP_SRC && op != PIXMAN_OP_OVER) {
+		return false;
+	}
+
+	if (opacity.IsSplit() || src.pixman_format != pixman_format) {
+		return false;
+	}
+
+	switch (pixman_format) {
+		case PIXMAN_a8r8g8b8:
+		case PIXMAN_a8b8g8r8:
+		case PIXMAN_b8g8r8a8:
+		case PIXMAN_r8g8b8a8:
+			break;
+		default:
+			return false;
+	}
+
+	AffineBlit::Mapping mapping;
+	return AffineBlit::FromTransform(xform.matrix.matrix, 0, 0, mapping);
+}
+
+void Bitmap::BlitAffine(Rect dst_rect, Bitmap const& src, Rect const& src_rect, Transform const& xform,
+		int offset_x, int offset_y, Opacity const& opacity, pixman_op_t op) {
+	dst_rect.Adjust(GetRect());
+	if (!clip_rect.IsEmpty()) {
+		dst_rect.Adjust(clip_rect);
+	}
+	if (dst_rect.IsEmpty()) {
+		return;
+	}
+
+	AffineBlit::Mapping mapping;
+	AffineBlit::FromTransform(xform.matrix.matrix, offset_x, offset_y, mapping);
+
+	// The alpha channel is the high byte of the ARGB and ABGR formats
+	const int alpha_shift = (pixman_format == PIXMAN_a8r8g8b8 || pixman_format == PIXMAN_a8b8g8r8) ? 24 : 0;
+
+	const auto* src_pixels = reinterpret_cast<const uint8_t*>(src.pixels()) + src_rect.x * 4 + src_rect.y * src.pitch();
+
+	AffineBlit::Blit(reinterpret_cast<uint32_t*>(pixels()), pitch(), dst_rect,
+		reinterpret_cast<const uint32_t*>(src_pixels), src.pitch(), src_rect.width, src_rect.height,
+		mapping, std::min(opacity.Value(), 255), alpha_shift,
+		op == PIXMAN_OP_SRC ? AffineBlit::Op::Src : AffineBlit::Op::Over);
+}
+
 void Bitmap::EdgeMirrorBlit(int x, int y, Bitmap const& src, Rect const& src_rect, bool mirror_x, bool mirror_y, Opacity const& opacity) {
+	if (EP_UNLIKELY(recorder) && &src != this) {
+		recorder->Record([=, &src](Bitmap& dst) { dst.EdgeMirrorBlit(x, y, src, src_rect, mirror_x, mirror_y, opacity); }, src);
+		return;
+	}
+	ParallelRenderer::Barrier barrier(*this);
+
 	if (opacity.IsTransparent())
 		return;
 
@@ -38,6 +38,7 @@
 #include "string_view.h"
 
 struct Transform;
+class ParallelRenderer;
 
 /**
  * Base Bitmap class.
@@ -108,6 +109,9 @@ public:
 	Bitmap(Bitmap const& source, Rect const& src_rect, bool transparent);
 	Bitmap(void *pixels, int width, int height, int pitch, const DynamicFormat& format);
 
+	/** Flushes the recorded commands that read from the bitmap */
+	~Bitmap();
+
 	/**
 	 * Gets the bitmap width.
 	 *
@@ -136,6 +140,20 @@ public:
 	 */
 	size_t GetSize() const;
 
+	/**
+	 * Restricts all drawing operations on this bitmap to a rectangle.
+	 *
+	 * @param rect clip rectangle, an empty rectangle disables clipping
+	 */
+	void SetClipRect(const Rect& rect);
+
+	/**
+	 * Gets the clip rectangle.
+	 *
+	 * @return clip rectangle, empty when clipping is disabled
+	 */
+	Rect GetClipRect() const;
+
 	/**
 	 * Gets if bitmap allows transparency.
 	 *
@@ -200,6 +218,14 @@ public:
 	 */
 	bool WritePNG(Filesystem_Stream::OutputStream&) const;
 
+	/**
+	 * Copies the pixels in the format expected by ImagePNG::WritePNG:
+	 * 24 bit RGB, every row is GetWidth() * 4 bytes long.
+	 *
+	 * @param dst buffer of GetWidth() * GetHeight() elements
+	 */
+	void ReadPixelsRGB(uint32_t* dst) const;
+
 	/**
 	 * Gets the background color
 	 * Bitmap must have been loaded with the Bitmap::System flag
@@ -226,6 +252,15 @@ public:
 
 	void CheckPixels(uint32_t flags);
 
+	/**
+	 * Recalculates the opacity information of a single tile after it was
+	 * modified. The bitmap must have been checked with Flag_Chipset.
+	 *
+	 * @param x tile x coordinate
+	 * @param y tile y coordinate
+	 */
+	void CheckTileOpacity(int x, int y);
+
 	/**
 	 * @param x x-coordinate
 	 * @param y y-coordinate
@@ -606,7 +641,23 @@ protected:
 	void Init(int width, int height, void* data, int pitch = 0, bool destroy = true);
 	void ConvertImage(int& width, int& height, void*& pixels, bool transparent);
 
+	/**
+	 * Restores the bitmap from an ImageCache entry.
+	 *
+	 * @param data cached data created by SaveCached
+	 * @param flags load flags, must match the flags passed to SaveCached
+	 * @return true on success
+	 */
+	bool LoadCached(const std::vector<uint8_t>& data, uint32_t flags);
+
+	/**
+	 * @param flags load flags of the bitmap
+	 * @return pixels and opacity information for the ImageCache
+	 */
+	std::vector<uint8_t> SaveCached(uint32_t flags) const;
+
 	static PixmanImagePtr GetSubimage(Bitmap const& src, const Rect& src_rect);
+	static PixmanImagePtr GetTransformableImage(Bitmap const& src);
 	static inline void MultiplyAlpha(uint8_t &r, uint8_t &g, uint8_t &b, const uint8_t &a) {
 		r = (uint8_t)((int)r * a / 0xFF);
 		g = (uint8_t)((int)g * a / 0xFF);
@@ -633,7 +684,56 @@ protected:
 	 * @return blend mode
 	 */
 	pixman_op_t GetOperator(pixman_image_t* mask = nullptr, BlendMode blend_mode = BlendMode::Default) const;
+
+	/**
+	 * Like GetOperator but does not require a mask image.
+	 *
+	 * @param has_mask Whether the operation uses a mask
+	 * @param blend_mode When >= 0: Force this blend mode as operator
+	 * @return blend mode
+	 */
+	pixman_op_t SelectOperator(bool has_mask, BlendMode blend_mode = BlendMode::Default) const;
+
+	/**
+	 * Checks whether a transformed blit can use the AffineBlit kernels
+	 * instead of pixman.
+	 *
+	 * @param src source bitmap
+	 * @param xform transform of the source image
+	 * @param opacity opacity of the blit
+	 * @param op operator of the blit
+	 * @return whether BlitAffine can be used
+	 */
+	bool CanBlitAffine(Bitmap const& src, Transform const& xform, Opacity const& opacity, pixman_op_t op) const;
+
+	/**
+	 * Draws a transformed source with the AffineBlit kernels, must only be
+	 * called when CanBlitAffine is true. Behaves like a pixman composite
+	 * of GetSubimage(src, src_rect) with the transform.
+	 *
+	 * @param dst_rect destination rectangle, clipped to the bitmap
+	 * @param src source bitmap
+	 * @param src_rect source image inside of src
+	 * @param xform transform of the source image
+	 * @param offset_x source x of the composite minus destination x
+	 * @param offset_y source y of the composite minus destination y
+	 * @param opacity opacity of the blit
+	 * @param op operator of the blit
+	 */
+	void BlitAffine(Rect dst_rect, Bitmap const& src, Rect const& src_rect, Transform const& xform,
+		int offset_x, int offset_y, Opacity const& opacity, pixman_op_t op);
 	bool read_only = false;
+
+	friend class ParallelRenderer;
+
+	/** When set drawing operations are recorded by the renderer instead of being executed */
+	ParallelRenderer* recorder = nullptr;
+	/** When set the renderer has recorded commands reading from this bitmap */
+	mutable ParallelRenderer* pending_reader = nullptr;
+
+	/** Flushes the recorded commands reading from this bitmap, must be called before modifying it */
+	void FlushPendingReads();
+	Rect clip_rect;
 };
 
 inline ImageOpacity Bitmap::GetImageOpacity() const {
@@ -664,6 +764,10 @@ inline Rect Bitmap::GetRect() const {
 	return Rect(0, 0, width(), height());
 }
 
+inline Rect Bitmap::GetClipRect() const {
+	return clip_rect;
+}
+
 inline bool Bitmap::GetTransparent() const {
 	return format.alpha_type != PF::NoAlpha;
 }
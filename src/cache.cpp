@@ -20,8 +20,8 @@
 #  pragma warning(disable: 4003)
 #endif
 
-#include <map>
-#include <tuple>
+#include <deque>
+#include <unordered_map>
 #include <chrono>
 #include <cassert>
 
@@ -33,40 +33,46 @@
 #include "bitmap.h"
 #include "output.h"
 #include "player.h"
+#include "tilemap_layer.h"
 #include <lcf/data.h>
 #include "game_clock.h"
 
 using namespace std::chrono_literals;
 
 namespace {
-	std::string MakeHashKey(StringView folder_name, StringView filename, bool transparent) {
-		return ToString(folder_name) + ":" + ToString(filename) + ":" + (transparent ? "T" : " ");
+	struct NameHash {
+		size_t operator()(StringView name) const {
+			// FNV-1a
+			uint32_t hash = 2166136261u;
+			for (unsigned char c: name) {
+				hash = (hash ^ c) * 16777619u;
+			}
+			return hash;
+		}
+	};
+
+	// deque: The strings never move, the map keys point into them
+	std::deque<std::string> interned_names = { std::string() };
+	std::unordered_map<StringView, uint32_t, NameHash> interned_ids = { { StringView(interned_names.front()), 0 } };
+
+	using key_type = uint64_t;
+
+	key_type MakeHashKey(int material, Cache::AssetId filename, bool transparent) {
+		return (static_cast<key_type>(filename.GetId()) << 32) | (static_cast<key_type>(material + 1) << 1) | (transparent ? 1 : 0);
 	}
 
-	std::string MakeTileHashKey(StringView chipset_name, int id) {
-		std::string key;
-		key.reserve(chipset_name.size() + sizeof(int) + 2);
-		key.append(reinterpret_cast<char*>(&id), sizeof(id));
-		key.append(1, ':');
-		key.append(chipset_name.begin(), chipset_name.end());
+	using tile_key_type = uint64_t;
 
-		return key;
+	tile_key_type MakeTileHashKey(Cache::AssetId chipset_name, int id) {
+		return (static_cast<tile_key_type>(chipset_name.GetId()) << 32) | static_cast<uint32_t>(id);
 	}
 
-	int IdFromTileHash(StringView key) {
-		int id = 0;
-		if (key.size() > sizeof(id)) {
-			std::memcpy(&id, key.data(), sizeof(id));
-		}
-		return id;
+	int IdFromTileHash(tile_key_type key) {
+		return static_cast<int>(static_cast<uint32_t>(key));
 	}
 
-	const char* NameFromTileHash(StringView key) {
-		int offset = sizeof(int) + 1;
-		if (static_cast<int>(key.size()) < offset) {
-			return "";
-		}
-		return key.data() + offset;
+	StringView NameFromTileHash(tile_key_type key) {
+		return interned_names[key >> 32];
 	}
 
 	struct CacheItem {
@@ -74,15 +80,57 @@ namespace {
 		Game_Clock::time_point last_access;
 	};
 
-	using key_type = std::string;
 	std::unordered_map<key_type, CacheItem> cache;
 
-	using tile_key_type = std::string;
 	std::unordered_map<tile_key_type, std::weak_ptr<Bitmap>> cache_tiles;
 
-	// rect, flip_x, flip_y, tone, blend
-	using effect_key_type = std::tuple<BitmapRef, Rect, bool, bool, Tone, Color>;
-	std::map<effect_key_type, std::weak_ptr<Bitmap>> cache_effects;
+	struct EffectKey {
+		const Bitmap* src;
+		Rect rect;
+		Tone tone;
+		Color blend;
+		bool flip_x;
+		bool flip_y;
+	};
+
+	bool operator==(const EffectKey& l, const EffectKey& r) {
+		return l.src == r.src && l.rect == r.rect && l.tone == r.tone && l.blend == r.blend
+			&& l.flip_x == r.flip_x && l.flip_y == r.flip_y;
+	}
+
+	struct EffectKeyHash {
+		size_t operator()(const EffectKey& key) const {
+			size_t hash = std::hash<const Bitmap*>()(key.src);
+			auto combine = [&hash](size_t v) {
+				hash ^= v + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+			};
+			combine((static_cast<size_t>(key.rect.x) << 16) ^ static_cast<size_t>(key.rect.y));
+			combine((static_cast<size_t>(key.rect.width) << 16) ^ static_cast<size_t>(key.rect.height));
+			combine((static_cast<size_t>(key.tone.red) << 24) ^ (key.tone.green << 16) ^ (key.tone.blue << 8) ^ key.tone.gray);
+			combine((static_cast<size_t>(key.blend.red) << 24) ^ (key.blend.green << 16) ^ (key.blend.blue << 8) ^ key.blend.alpha);
+			combine(key.flip_x | (key.flip_y << 1));
+			return hash;
+		}
+	};
+
+	struct EffectItem {
+		// The source address is only valid while the source is alive
+		std::weak_ptr<Bitmap> src;
+		BitmapRef bitmap;
+		Game_Clock::time_point last_access;
+	};
+
+	std::unordered_map<EffectKey, EffectItem, EffectKeyHash> cache_effects;
+
+	constexpr size_t effect_cache_limit = 4 * 1024 * 1024;
+	size_t effect_cache_size = 0;
+
+	struct AutotilesItem {
+		std::shared_ptr<TilemapAutotiles> autotiles;
+		Game_Clock::time_point last_access;
+	};
+
+	std::unordered_map<const Bitmap*, AutotilesItem> cache_autotiles;
 
 	std::string system_name;
 
@@ -94,6 +142,16 @@ namespace {
 	void FreeBitmapMemory() {
 		auto cur_ticks = Game_Clock::GetFrameTime();
 
+		// Autotiles reference their chipset, free them first
+		for (auto it = cache_autotiles.begin(); it != cache_autotiles.end();) {
+			if (it->second.autotiles.use_count() != 1 || cur_ticks - it->second.last_access <= 3s) {
+				++it;
+				continue;
+			}
+
+			it = cache_autotiles.erase(it);
+		}
+
 		for (auto it = cache.begin(); it != cache.end();) {
 			if (it->second.bitmap.use_count() != 1) {
 				// Bitmap is referenced
@@ -115,7 +173,7 @@ namespace {
 			}
 
 #ifdef CACHE_DEBUG
-			Output::Debug("Freeing memory of {}/{}", std::get<0>(i.first), std::get<1>(i.first));
+			Output::Debug("Freeing memory of {}", interned_names[it->first >> 32]);
 #endif
 
 			cache_size -= it->second.bitmap->GetSize();
@@ -128,7 +186,63 @@ namespace {
 #endif
 	}
 
-	BitmapRef AddToCache(const std::string& key, BitmapRef bmp) {
+	void FreeEffectMemory() {
+		auto cur_ticks = Game_Clock::GetFrameTime();
+
+		for (auto it = cache_effects.begin(); it != cache_effects.end();) {
+			auto& item = it->second;
+			if (!item.src.expired()) {
+				if (item.bitmap.use_count() != 1) {
+					// Effect is displayed by a sprite
+					++it;
+					continue;
+				}
+
+				auto last_access = cur_ticks - item.last_access;
+				if (last_access <= 50ms || (effect_cache_size <= effect_cache_limit && last_access <= 3s)) {
+					++it;
+					continue;
+				}
+			}
+
+			effect_cache_size -= item.bitmap->GetSize();
+			it = cache_effects.erase(it);
+		}
+	}
+
+	void ApplySpriteEffect(Bitmap& dst, const Bitmap& src_bitmap, const Rect& rect, bool flip_x, bool flip_y, const Tone& tone, const Color& blend) {
+		bool applied = false;
+
+		if (tone != Tone()) {
+			dst.ToneBlit(0, 0, src_bitmap, rect, tone, Opacity::Opaque());
+			applied = true;
+		}
+
+		if (blend != Color()) {
+			if (applied) {
+				// Tone blit was applied
+				dst.BlendBlit(0, 0, dst, dst.GetRect(), blend, Opacity::Opaque());
+			} else {
+				dst.BlendBlit(0, 0, src_bitmap, rect, blend, Opacity::Opaque());
+				applied = true;
+			}
+		}
+
+		if (flip_x || flip_y) {
+			if (applied) {
+				// Tone or blend blit was applied
+				dst.Flip(flip_x, flip_y);
+			} else {
+				dst.FlipBlit(rect.x, rect.y, src_bitmap, rect, flip_x, flip_y, Opacity::Opaque());
+				applied = true;
+			}
+		}
+
+		assert(applied && "Effect cache used but no effect applied!");
+		(void)applied;
+	}
+
+	BitmapRef AddToCache(key_type key, BitmapRef bmp) {
 		if (bmp) {
 			cache_size += bmp->GetSize();
 #ifdef CACHE_DEBUG
@@ -235,9 +349,10 @@ namespace {
 	}
 
 	template<Material::Type T>
-	BitmapRef LoadBitmap(StringView filename, bool transparent) {
+	BitmapRef LoadBitmap(Cache::AssetId asset, bool transparent) {
 		static_assert(Material::REND < T && T < Material::END, "Invalid material.");
 		const Spec& s = spec[T];
+		const StringView filename = asset.GetName();
 
 		// This assert is triggered by the request cache clear when switching languages
 		// Remove comment to test if all assets are requested correctly
@@ -246,7 +361,7 @@ namespace {
 
 		BitmapRef bmp;
 
-		const auto key = MakeHashKey(s.directory, filename, transparent);
+		const auto key = MakeHashKey(T, asset, transparent);
 		auto it = cache.find(key);
 		if (it == cache.end()) {
 			if (filename == CACHE_DEFAULT_BITMAP) {
@@ -311,6 +426,11 @@ namespace {
 		return bmp;
 	}
 
+	template<Material::Type T>
+	BitmapRef LoadBitmap(StringView filename, bool transparent) {
+		return LoadBitmap<T>(Cache::Intern(filename), transparent);
+	}
+
 	template<Material::Type T>
 	BitmapRef LoadBitmap(StringView f) {
 		static_assert(Material::REND < T && T < Material::END, "Invalid material.");
@@ -319,6 +439,22 @@ namespace {
 	}
 }
 
+StringView Cache::AssetId::GetName() const {
+	return interned_names[id];
+}
+
+Cache::AssetId Cache::Intern(StringView filename) {
+	auto it = interned_ids.find(filename);
+	if (it != interned_ids.end()) {
+		return AssetId(it->second);
+	}
+
+	const auto id = static_cast<uint32_t>(interned_names.size());
+	interned_names.emplace_back(ToString(filename));
+	interned_ids.emplace(StringView(interned_names.back()), id);
+	return AssetId(id);
+}
+
 std::vector<uint8_t> Cache::exfont_custom;
 
 BitmapRef Cache::Backdrop(StringView file) {
@@ -345,10 +481,18 @@ BitmapRef Cache::Charset(StringView file) {
 	return LoadBitmap<Material::Charset>(file);
 }
 
+BitmapRef Cache::Charset(AssetId file) {
+	return LoadBitmap<Material::Charset>(file, spec[Material::Charset].transparent);
+}
+
 BitmapRef Cache::Chipset(StringView file) {
 	return LoadBitmap<Material::Chipset>(file);
 }
 
+BitmapRef Cache::Chipset(AssetId file) {
+	return LoadBitmap<Material::Chipset>(file, spec[Material::Chipset].transparent);
+}
+
 BitmapRef Cache::Faceset(StringView file) {
 	return LoadBitmap<Material::Faceset>(file);
 }
@@ -373,6 +517,10 @@ BitmapRef Cache::Picture(StringView file, bool transparent) {
 	return LoadBitmap<Material::Picture>(file, transparent);
 }
 
+BitmapRef Cache::Picture(AssetId file, bool transparent) {
+	return LoadBitmap<Material::Picture>(file, transparent);
+}
+
 BitmapRef Cache::System2(StringView file) {
 	return LoadBitmap<Material::System2>(file);
 }
@@ -386,7 +534,7 @@ BitmapRef Cache::System(StringView file) {
 }
 
 BitmapRef Cache::Exfont() {
-	const auto key = MakeHashKey("ExFont", "ExFont", false);
+	const auto key = MakeHashKey(Material::END, Intern("ExFont"), false);
 
 	auto it = cache.find(key);
 
@@ -410,6 +558,10 @@ BitmapRef Cache::Exfont() {
 }
 
 BitmapRef Cache::Tile(StringView filename, int tile_id) {
+	return Tile(Intern(filename), tile_id);
+}
+
+BitmapRef Cache::Tile(AssetId filename, int tile_id) {
 	const auto key = MakeTileHashKey(filename, tile_id);
 	auto it = cache_tiles.find(key);
 
@@ -443,57 +595,59 @@ BitmapRef Cache::Tile(StringView filename, int tile_id) {
 }
 
 BitmapRef Cache::SpriteEffect(const BitmapRef& src_bitmap, const Rect& rect, bool flip_x, bool flip_y, const Tone& tone, const Color& blend) {
-	const effect_key_type key {
-		src_bitmap,
+	const EffectKey key {
+		src_bitmap.get(),
 		rect,
-		flip_x,
-		flip_y,
 		tone,
-		blend
+		blend,
+		flip_x,
+		flip_y
 	};
 
 	const auto it = cache_effects.find(key);
 
-	if (it == cache_effects.end() || it->second.expired()) {
-		BitmapRef bitmap_effects;
+	if (it != cache_effects.end() && !it->second.src.expired()) {
+		it->second.last_access = Game_Clock::GetFrameTime();
+		return it->second.bitmap;
+	}
 
-		auto create = [&rect] () -> BitmapRef {
-			return Bitmap::Create(rect.width, rect.height, true);
-		};
+	FreeEffectMemory();
 
-		if (tone != Tone()) {
-			bitmap_effects = create();
-			bitmap_effects->ToneBlit(0, 0, *src_bitmap, rect, tone, Opacity::Opaque());
-		}
+	auto bitmap_effects = Bitmap::Create(rect.width, rect.height, true);
+	ApplySpriteEffect(*bitmap_effects, *src_bitmap, rect, flip_x, flip_y, tone, blend);
 
-		if (blend != Color()) {
-			if (bitmap_effects) {
-				// Tone blit was applied
-				bitmap_effects->BlendBlit(0, 0, *bitmap_effects, bitmap_effects->GetRect(), blend, Opacity::Opaque());
-			} else {
-				bitmap_effects = create();
-				bitmap_effects->BlendBlit(0, 0, *src_bitmap, rect, blend, Opacity::Opaque());
-			}
-		}
+	// FreeEffectMemory removed entries of destroyed bitmaps at the same address
+	cache_effects[key] = { src_bitmap, bitmap_effects, Game_Clock::GetFrameTime() };
+	effect_cache_size += bitmap_effects->GetSize();
 
-		if (flip_x || flip_y) {
-			if (bitmap_effects) {
-				// Tone or blend blit was applied
-				bitmap_effects->Flip(flip_x, flip_y);
-			} else {
-				bitmap_effects = create();
-				bitmap_effects->FlipBlit(rect.x, rect.y, *src_bitmap, rect, flip_x, flip_y, Opacity::Opaque());
-			}
-		}
+	return bitmap_effects;
+}
 
-		assert(bitmap_effects && "Effect cache used but no effect applied!");
+void Cache::SpriteEffect(BitmapRef& scratch, const Bitmap& src_bitmap, const Rect& rect, bool flip_x, bool flip_y, const Tone& tone, const Color& blend) {
+	if (!scratch || scratch.use_count() != 1 || scratch->GetWidth() != rect.width || scratch->GetHeight() != rect.height) {
+		scratch = Bitmap::Create(rect.width, rect.height, true);
+	} else {
+		scratch->Clear();
+	}
 
-		return(cache_effects[key] = bitmap_effects).lock();
-	} else { return it->second.lock(); }
+	ApplySpriteEffect(*scratch, src_bitmap, rect, flip_x, flip_y, tone, blend);
+}
+
+std::shared_ptr<TilemapAutotiles> Cache::Autotiles(const BitmapRef& chipset) {
+	auto& item = cache_autotiles[chipset.get()];
+	if (!item.autotiles) {
+		// The autotiles keep the chipset alive, so the address cannot be reused
+		item.autotiles = std::make_shared<TilemapAutotiles>(chipset);
+	}
+	item.last_access = Game_Clock::GetFrameTime();
+
+	return item.autotiles;
 }
 
 void Cache::Clear() {
+	cache_autotiles.clear();
 	cache_effects.clear();
+	effect_cache_size = 0;
 	cache.clear();
 	cache_size = 0;
 
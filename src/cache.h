@@ -20,6 +20,7 @@
 
 // Headers
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,11 +33,48 @@
 class Color;
 class Rect;
 class Tone;
+class TilemapAutotiles;
 
 /**
  * Cache namespace.
  */
 namespace Cache {
+	/**
+	 * Handle of an interned file name.
+	 * Lookups with a handle do not build a string key, callers that request
+	 * the same file repeatedly resolve the name once with Intern.
+	 * Handles stay valid for the whole runtime of the Player.
+	 */
+	class AssetId {
+	public:
+		/** Creates the handle of the empty file name */
+		constexpr AssetId() = default;
+
+		/** @return the interned file name */
+		StringView GetName() const;
+
+		/** @return unique id of the file name */
+		uint32_t GetId() const;
+
+		friend bool operator==(AssetId l, AssetId r) { return l.id == r.id; }
+		friend bool operator!=(AssetId l, AssetId r) { return l.id != r.id; }
+
+	private:
+		explicit constexpr AssetId(uint32_t id) : id(id) {}
+		friend AssetId Intern(StringView filename);
+
+		uint32_t id = 0;
+	};
+
+	/**
+	 * Interns a file name.
+	 * Allocates only the first time a file name is interned.
+	 *
+	 * @param filename file name
+	 * @return handle of the file name
+	 */
+	AssetId Intern(StringView filename);
+
 	BitmapRef Backdrop(StringView filename);
 	BitmapRef Battle(StringView filename);
 	BitmapRef Battle2(StringView filename);
@@ -55,9 +93,38 @@ namespace Cache {
 	BitmapRef System(StringView filename);
 	BitmapRef System2(StringView filename);
 
+	BitmapRef Charset(AssetId filename);
+	BitmapRef Chipset(AssetId filename);
+	BitmapRef Picture(AssetId filename, bool transparent);
+
 	BitmapRef Tile(StringView filename, int tile_id);
+	BitmapRef Tile(AssetId filename, int tile_id);
 	BitmapRef SpriteEffect(const BitmapRef& src_bitmap, const Rect& rect, bool flip_x, bool flip_y, const Tone& tone, const Color& blend);
 
+	/**
+	 * Renders sprite effects into a bitmap of the caller instead of the cache.
+	 * Used for effects that change every frame, e.g. flashes.
+	 *
+	 * @param scratch target, reused when it has the size of rect and is not shared, otherwise replaced
+	 * @param src_bitmap source bitmap
+	 * @param rect source rect
+	 * @param flip_x flip horizontally
+	 * @param flip_y flip vertically
+	 * @param tone tone to apply
+	 * @param blend blend color to apply
+	 */
+	void SpriteEffect(BitmapRef& scratch, const Bitmap& src_bitmap, const Rect& rect, bool flip_x, bool flip_y, const Tone& tone, const Color& blend);
+
+	/**
+	 * Gets the composite autotiles of a chipset.
+	 * All tilemaps using the same chipset share the generated autotiles,
+	 * they are kept for a while after the last tilemap released them.
+	 *
+	 * @param chipset chipset bitmap
+	 * @return autotiles of the chipset
+	 */
+	std::shared_ptr<TilemapAutotiles> Autotiles(const BitmapRef& chipset);
+
 	void Clear();
 	void ClearAll();
 
@@ -79,4 +146,8 @@ namespace Cache {
 	extern std::vector<uint8_t> exfont_custom;
 }
 
+inline uint32_t Cache::AssetId::GetId() const {
+	return id;
+}
+
 #endif
@@ -18,6 +18,8 @@
 // Headers
 #include "drawable_list.h"
 #include "drawable_mgr.h"
+#include "instrumentation.h"
+#include "parallel_renderer.h"
 #include <algorithm>
 #include <cassert>
 
@@ -40,10 +42,41 @@ bool DrawableList::IsSorted() const {
 	return std::is_sorted(_list.begin(), _list.end(), DrawCmp);
 }
 
+/**
+ * Stable insertion sort, fast when only a few drawables changed their Z value
+ * since the last sort (e.g. moving characters).
+ *
+ * @return false when more than max_moves shifts were required. The list is
+ * partially sorted then, the order of drawables with the same Z is preserved.
+ */
+static bool InsertionSort(std::vector<Drawable*>& list, size_t max_moves) {
+	size_t moves = 0;
+	for (size_t i = 1; i < list.size(); ++i) {
+		auto* drawable = list[i];
+		const auto z = drawable->GetZ();
+
+		size_t j = i;
+		for (; j > 0 && list[j - 1]->GetZ() > z; --j) {
+			list[j] = list[j - 1];
+		}
+		list[j] = drawable;
+
+		moves += i - j;
+		if (moves > max_moves) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void DrawableList::Sort() {
 	// stable sort to work around a flickering event sprite issue when
 	// the map is scrolling (have same Z value)
-	std::stable_sort(_list.begin(), _list.end(), DrawCmp);
+	// Usually the list is almost sorted, a full sort is only done when
+	// the insertion sort has to move too many drawables.
+	if (!InsertionSort(_list, _list.size())) {
+		std::stable_sort(_list.begin(), _list.end(), DrawCmp);
+	}
 	SetClean();
 }
 
@@ -90,13 +123,19 @@ void DrawableList::TakeFrom(DrawableList& other) noexcept {
 	other.SetClean();
 }
 
-void DrawableList::Draw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z) {
+void DrawableList::Draw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z, ParallelRenderer* renderer) {
+	Instrumentation::ZoneScope zone("DrawableList::Draw");
+
 	if (IsDirty()) {
 		Sort();
 	} else {
 		assert(IsSorted());
 	}
 
+	if (renderer) {
+		renderer->Begin(dst);
+	}
+
 	for (auto* drawable : _list) {
 		auto z = drawable->GetZ();
 		if (z < min_z) {
@@ -109,5 +148,9 @@ void DrawableList::Draw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z) {
 			drawable->Draw(dst);
 		}
 	}
+
+	if (renderer) {
+		renderer->End();
+	}
 }
 
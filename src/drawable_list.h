@@ -23,6 +23,8 @@
 #include <vector>
 #include <limits>
 
+class ParallelRenderer;
+
 /** A list of Drawable objects. These are used by the graphics engine store and
  * to render all drawable objects.
  */
@@ -128,8 +130,9 @@ class DrawableList {
 		 * @param dst The bitmap to draw onto
 		 * @param min_z Skip any drawables with z < min_z
 		 * @param max_z Skip any drawables with z > max_z
+		 * @param renderer When set the drawing operations are recorded and rendered in parallel
 		 */
-		void Draw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z);
+		void Draw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z, ParallelRenderer* renderer = nullptr);
 
 	private:
 		std::vector<Drawable*> _list;
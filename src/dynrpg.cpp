@@ -29,6 +29,7 @@
 #include <cstring>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 
 enum DynRpg_ParseMode {
 	ParseMode_Function,
@@ -41,6 +42,21 @@ enum DynRpg_ParseMode {
 typedef std::map<std::string, dynfunc> dyn_rpg_func;
 
 namespace {
+	/** Argument of a pre-parsed command */
+	struct DynRpg_Arg {
+		/** Value of a literal or the token of a reference */
+		std::string value;
+		/** N (actor name) and V (variable) references, resolved when invoked. Empty for literals */
+		std::string references;
+		int number = 0;
+	};
+
+	struct DynRpg_Command {
+		std::string function_name;
+		dynfunc func = nullptr;
+		std::vector<DynRpg_Arg> args;
+	};
+
 	bool init = false;
 
 	// Registered DynRpg Plugins
@@ -48,10 +64,16 @@ namespace {
 
 	// DynRpg Function table
 	dyn_rpg_func dyn_rpg_functions;
+
+	// Pre-parsed commands by command text
+	std::unordered_map<std::string, DynRpg_Command> command_cache;
+	constexpr size_t command_cache_limit = 4096;
 }
 
 void DynRpg::RegisterFunction(const std::string& name, dynfunc func) {
 	dyn_rpg_functions[name] = func;
+	// The cached commands contain function pointers
+	command_cache.clear();
 }
 
 bool DynRpg::HasFunction(const std::string& name) {
@@ -112,74 +134,69 @@ std::string DynRpg::ParseVarArg(StringView func_name, dyn_arg_list args, int ind
 }
 
 
-static std::string ParseToken(const std::string& token, const std::string& function_name) {
-	std::string::iterator text_index, end;
-	std::string text = token;
-	text_index = text.begin();
-	end = text.end();
-
-	char chr = *text_index;
+static DynRpg_Arg ParseToken(const std::string& token) {
+	DynRpg_Arg arg;
 
 	bool first = true;
-
 	bool number_encountered = false;
 
-	std::stringstream var_part;
-	std::stringstream number_part;
+	std::string var_part;
+	std::string number_part;
 
-	for (;;) {
-		if (text_index != end) {
-			chr = *text_index;
+	for (char chr: token) {
+		if (number_encountered || (chr >= '0' && chr <= '9')) {
+			number_encountered = true;
+			number_part += chr;
+		} else if (chr == 'N' && first) {
+			var_part += chr;
+		} else if (chr == 'V') {
+			var_part += chr;
+		} else {
+			// Normal token
+			arg.value = Utils::LowerCase(token);
+			return arg;
 		}
 
-		if (text_index == end) {
-			// Variable reference
-			std::string tmp = number_part.str();
-			int number = atoi(tmp.c_str());
-			tmp = var_part.str();
-			if (tmp.empty()) {
-				return token;
-			}
+		first = false;
+	}
 
-			// Convert backwards
-			for (std::string::reverse_iterator it = tmp.rbegin(); it != tmp.rend(); ++it) {
-				if (*it == 'N') {
-					if (!Main_Data::game_actors->ActorExists(number)) {
-						Output::Warning("{}: ID nhân vật {} trong {} không hợp lệ", function_name, number, token);
-						return "";
-					}
+	// Variable reference, resolved when invoked
+	arg.value = token;
+	arg.references = var_part;
+	arg.number = atoi(number_part.c_str());
+	return arg;
+}
 
-					// N is last
-					return ToString(Main_Data::game_actors->GetActor(number)->GetName());
-				} else {
-					// Variable
-					number = Main_Data::game_variables->Get(number);
-				}
-			}
+static DynRpg_Arg LiteralArg(std::string value) {
+	DynRpg_Arg arg;
+	arg.value = std::move(value);
+	return arg;
+}
 
-			number_part.str("");
-			number_part << number;
-			return number_part.str();
-		} else if (number_encountered || (chr >= '0' && chr <= '9')) {
-			number_encountered = true;
-			number_part << chr;
-		} else if (chr == 'N') {
-			if (!first) {
-				break;
+static std::string ResolveArg(const DynRpg_Arg& arg, const std::string& function_name) {
+	if (arg.references.empty()) {
+		return arg.value;
+	}
+
+	int number = arg.number;
+
+	// Convert backwards
+	for (auto it = arg.references.rbegin(); it != arg.references.rend(); ++it) {
+		if (*it == 'N') {
+			if (!Main_Data::game_actors->ActorExists(number)) {
+				Output::Warning("{}: ID nhân vật {} trong {} không hợp lệ", function_name, number, arg.value);
+				return "";
 			}
-			var_part << chr;
-		} else if (chr == 'V') {
-			var_part << chr;
+
+			// N is last
+			return ToString(Main_Data::game_actors->GetActor(number)->GetName());
 		} else {
-			break;
+			// Variable
+			number = Main_Data::game_variables->Get(number);
 		}
-
-		++text_index;
-		first = false;
 	}
 
-	// Normal token
-	return Utils::LowerCase(token);
+	return std::to_string(number);
 }
 
 void create_all_plugins() {
@@ -192,7 +209,7 @@ void create_all_plugins() {
 	init = true;
 }
 
-std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::string>& args) {
+static std::string ParseCommandArgs(const std::string& command, std::vector<DynRpg_Arg>& args) {
 	if (command.empty()) {
 		// Not a DynRPG function (empty comment)
 		return "";
@@ -212,7 +229,6 @@ std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::st
 
 	DynRpg_ParseMode mode = ParseMode_Function;
 	std::string function_name;
-	std::string tmp;
 	std::stringstream token;
 
 	++text_index;
@@ -248,16 +264,15 @@ std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::st
 				case ParseMode_WaitForArg:
 					if (!args.empty()) {
 						// Found , but no token -> empty arg
-						args.emplace_back("");
+						args.push_back(LiteralArg(""));
 					}
 					break;
 				case ParseMode_String:
 					// Unterminated literal, handled like a terminated literal
-					args.emplace_back(token.str());
+					args.push_back(LiteralArg(token.str()));
 					break;
 				case ParseMode_Token:
-					tmp = ParseToken(token.str(), function_name);
-					args.emplace_back(tmp);
+					args.push_back(ParseToken(token.str()));
 					break;
 			}
 
@@ -299,7 +314,7 @@ std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::st
 					}
 					token.str("");
 					// Empty arg
-					args.emplace_back("");
+					args.push_back(LiteralArg(""));
 					mode = ParseMode_WaitForArg;
 					break;
 				case ParseMode_WaitForComma:
@@ -307,14 +322,13 @@ std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::st
 					break;
 				case ParseMode_WaitForArg:
 					// Empty arg
-					args.emplace_back("");
+					args.push_back(LiteralArg(""));
 					break;
 				case ParseMode_String:
 					token << chr;
 					break;
 				case ParseMode_Token:
-					tmp = ParseToken(token.str(), function_name);
-					args.emplace_back(tmp);
+					args.push_back(ParseToken(token.str()));
 					// already on a comma
 					mode = ParseMode_WaitForArg;
 					token.str("");
@@ -349,7 +363,7 @@ std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::st
 						}
 						else {
 							// End of string
-							args.emplace_back(token.str());
+							args.push_back(LiteralArg(token.str()));
 
 							mode = ParseMode_WaitForComma;
 							token.str("");
@@ -371,19 +385,57 @@ std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::st
 	return function_name;
 }
 
+std::string DynRpg::ParseCommand(const std::string& command, std::vector<std::string>& args) {
+	std::vector<DynRpg_Arg> parsed_args;
+	std::string function_name = ParseCommandArgs(command, parsed_args);
+
+	for (const auto& arg: parsed_args) {
+		args.push_back(ResolveArg(arg, function_name));
+	}
+
+	return function_name;
+}
+
 bool DynRpg::Invoke(const std::string& command) {
 	if (!init) {
 		create_all_plugins();
 	}
 
-	std::vector<std::string> args;
-	std::string function_name = ParseCommand(command, args);
+	// Commands are parsed once, only the references are resolved on every call
+	auto it = command_cache.find(command);
+	if (it == command_cache.end()) {
+		if (command_cache.size() >= command_cache_limit) {
+			command_cache.clear();
+		}
 
-	if (function_name.empty()) {
+		DynRpg_Command cmd;
+		cmd.function_name = ParseCommandArgs(command, cmd.args);
+		auto func_it = dyn_rpg_functions.find(cmd.function_name);
+		if (func_it != dyn_rpg_functions.end()) {
+			cmd.func = func_it->second;
+		}
+		it = command_cache.emplace(command, std::move(cmd)).first;
+	}
+
+	const auto& cmd = it->second;
+	if (cmd.function_name.empty()) {
 		return true;
 	}
 
-	return Invoke(function_name, args);
+	if (!cmd.func) {
+		// Not a supported function
+		Output::Warning("Hàm DynRPG không được hỗ trợ: {}", cmd.function_name);
+		return true;
+	}
+
+	std::vector<std::string> args;
+	args.reserve(cmd.args.size());
+	for (const auto& arg: cmd.args) {
+		args.push_back(ResolveArg(arg, cmd.function_name));
+	}
+
+	// The function can invoke further commands, the cache entry is not used afterwards
+	return cmd.func(args);
 }
 
 bool DynRpg::Invoke(const std::string& func, dyn_arg_list args) {
@@ -530,5 +582,6 @@ void DynRpg::Update() {
 void DynRpg::Reset() {
 	init = false;
 	dyn_rpg_functions.clear();
+	command_cache.clear();
 	plugins.clear();
 }
@@ -20,6 +20,7 @@
 #include "filesystem_zip.h"
 #include "filesystem_stream.h"
 #include "filefinder.h"
+#include "instrumentation.h"
 #include "utils.h"
 #include "output.h"
 #include "player.h"
@@ -38,6 +39,7 @@ Filesystem_Stream::InputStream Filesystem::OpenInputStream(StringView name, std:
 		return Filesystem_Stream::InputStream();
 	}
 
+	Instrumentation::ZoneScope zone("Filesystem::OpenInputStream");
 	std::streambuf* buf = CreateInputStreambuffer(name, m | std::ios_base::in);
 
 	if (!buf) {
@@ -66,6 +68,7 @@ Filesystem_Stream::OutputStream Filesystem::OpenOutputStream(StringView name, st
 		return Filesystem_Stream::OutputStream();
 	}
 
+	Instrumentation::ZoneScope zone("Filesystem::OpenOutputStream");
 	std::streambuf* buf = CreateOutputStreambuffer(name, m | std::ios_base::out);
 
 	if (!buf) {
@@ -174,6 +177,14 @@ bool Filesystem::MakeDirectory(StringView, bool) const {
 	return false;
 }
 
+bool Filesystem::RenameFile(StringView, StringView) const {
+	return false;
+}
+
+bool Filesystem::RemoveFile(StringView) const {
+	return false;
+}
+
 bool Filesystem::IsValid() const {
 	// FIXME: better way to do this?
 	return Exists("");
@@ -367,6 +378,16 @@ bool FilesystemView::MakeDirectory(StringView dir, bool follow_symlinks) const {
 	return fs->MakeDirectory(MakePath(dir), follow_symlinks);
 }
 
+bool FilesystemView::RenameFile(StringView from, StringView to) const {
+	assert(fs);
+	return fs->RenameFile(MakePath(from), MakePath(to));
+}
+
+bool FilesystemView::RemoveFile(StringView path) const {
+	assert(fs);
+	return fs->RemoveFile(MakePath(path));
+}
+
 bool FilesystemView::IsFeatureSupported(Filesystem::Feature f) const {
 	assert(fs);
 	return fs->IsFeatureSupported(f);
@@ -46,7 +46,9 @@ public:
 	/** Features provided by the filesystem */
 	enum class Feature {
 		/** Filesystem supports Write operations */
-		Write = 1
+		Write = 1,
+		/** Filesystem supports replacing a file by renaming another file */
+		Rename = 2
 	};
 
 	virtual ~Filesystem() = default;
@@ -220,6 +222,8 @@ public:
 	virtual bool Exists(StringView path) const = 0;
 	virtual int64_t GetFilesize(StringView path) const = 0;
 	virtual bool MakeDirectory(StringView dir, bool follow_symlinks) const;
+	virtual bool RenameFile(StringView from, StringView to) const;
+	virtual bool RemoveFile(StringView path) const;
 	virtual bool IsFeatureSupported(Feature f) const;
 	virtual std::string Describe() const = 0;
 	/** @} */
@@ -461,6 +465,25 @@ public:
 	 */
 	bool MakeDirectory(StringView dir, bool follow_symlinks) const;
 
+	/**
+	 * Renames a file and replaces the destination when it exists.
+	 * Only supported when the filesystem provides Feature::Rename.
+	 *
+	 * @param from File to rename
+	 * @param to New name of the file
+	 * @return true when the file was renamed
+	 */
+	bool RenameFile(StringView from, StringView to) const;
+
+	/**
+	 * Deletes a file.
+	 * Only supported when the filesystem provides Feature::Rename.
+	 *
+	 * @param path File to delete
+	 * @return true when the file was deleted
+	 */
+	bool RemoveFile(StringView path) const;
+
 	/**
 	 * @param f Filesystem feature to check
 	 * @return true when the feature is supported.
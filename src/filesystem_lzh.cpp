@@ -68,6 +68,10 @@ static size_t vio_read_dec_func(void* buf, size_t buf_len, void* user_data) {
 	return f->gcount();
 }
 
+// Limits of the decompressed entry cache
+static constexpr size_t entry_cache_limit = 16 * 1024 * 1024;
+static constexpr size_t entry_cache_max_entry = 4 * 1024 * 1024;
+
 static LHAInputStreamType vio = {
 	vio_read_func,
 	vio_skip_func,
@@ -233,6 +237,13 @@ LzhFilesystem::LzhFilesystem(std::string base_path, FilesystemView parent_fs, St
 	lzh_entries.erase(lzh_entries.begin(), entries_del_it.base());
 }
 
+LzhFilesystem::~LzhFilesystem() {
+	if (cache_stats.hits + cache_stats.misses > 0) {
+		Output::Debug("LzhFS: {} opens, {} cache hits, {} bytes decompressed",
+			cache_stats.hits + cache_stats.misses, cache_stats.hits, cache_stats.bytes_inflated);
+	}
+}
+
 bool LzhFilesystem::IsFile(StringView path) const {
 	std::string path_normalized = normalize_path(path);
 	auto entry = Find(path);
@@ -267,38 +278,74 @@ int64_t LzhFilesystem::GetFilesize(StringView path) const {
 }
 
 std::streambuf* LzhFilesystem::CreateInputStreambuffer(StringView path, std::ios_base::openmode) const {
-	std::string path_normalized = normalize_path(path);
 	auto entry = Find(path);
-	if (entry && !entry->is_directory) {
-		// Determine compression method
-		auto* decoder_type = lha_decoder_for_name(const_cast<char*>(entry->compress_method.c_str()));
+	if (!entry || entry->is_directory) {
+		return nullptr;
+	}
 
-		if (!decoder_type) {
-			Output::Warning("LzhFS: Unsupported compression method {} for {}", entry->compress_method, path_normalized);
-			return nullptr;
-		}
+	auto it = entry_cache.find(entry);
+	if (it != entry_cache.end()) {
+		++cache_stats.hits;
+		it->second.last_use = ++entry_cache_clock;
+		return new Filesystem_Stream::InputSharedMemoryStreamBuf(it->second.data);
+	}
 
-		// Seek to the compressed data
-		is.clear();
-		is.seekg(entry->fileoffset, std::ios_base::beg);
+	++cache_stats.misses;
+	auto data = Decompress(*entry, path);
+	if (!data) {
+		return nullptr;
+	}
 
-		// Create a suitable decoder for the compression method
-		std::unique_ptr<LHADecoder, LhasaDeleter> decoder;
-		decoder.reset(lha_decoder_new(decoder_type, vio_read_dec_func, &is, entry->uncompressed_size));
+	AddToCache(entry, data);
+	return new Filesystem_Stream::InputSharedMemoryStreamBuf(std::move(data));
+}
 
-		// Decompress
-		auto dec_buf = std::vector<uint8_t>(entry->uncompressed_size);
-		size_t res = lha_decoder_read(decoder.get(), dec_buf.data(), dec_buf.size());
+std::shared_ptr<const std::vector<uint8_t>> LzhFilesystem::Decompress(const LzhEntry& entry, StringView path) const {
+	// Determine compression method
+	auto* decoder_type = lha_decoder_for_name(const_cast<char*>(entry.compress_method.c_str()));
 
-		if (res != entry->uncompressed_size) {
-			Output::Warning("LzhFS: Less data compressed than expected ({})", path_normalized);
-			return nullptr;
-		}
+	if (!decoder_type) {
+		Output::Warning("LzhFS: Unsupported compression method {} for {}", entry.compress_method, normalize_path(path));
+		return nullptr;
+	}
+
+	// Seek to the compressed data
+	is.clear();
+	is.seekg(entry.fileoffset, std::ios_base::beg);
+
+	// Create a suitable decoder for the compression method
+	std::unique_ptr<LHADecoder, LhasaDeleter> decoder;
+	decoder.reset(lha_decoder_new(decoder_type, vio_read_dec_func, &is, entry.uncompressed_size));
 
-		return new Filesystem_Stream::InputMemoryStreamBuf(std::move(dec_buf));
+	// Decompress
+	auto dec_buf = std::make_shared<std::vector<uint8_t>>(entry.uncompressed_size);
+	size_t res = lha_decoder_read(decoder.get(), dec_buf->data(), dec_buf->size());
+	cache_stats.bytes_inflated += res;
+
+	if (res != entry.uncompressed_size) {
+		Output::Warning("LzhFS: Less data compressed than expected ({})", normalize_path(path));
+		return nullptr;
 	}
 
-	return nullptr;
+	return dec_buf;
+}
+
+void LzhFilesystem::AddToCache(const LzhEntry* entry, std::shared_ptr<const std::vector<uint8_t>> data) const {
+	// Large entries (e.g. music) would evict everything else
+	if (data->size() > entry_cache_max_entry) {
+		return;
+	}
+
+	while (entry_cache_size + data->size() > entry_cache_limit && !entry_cache.empty()) {
+		auto lru = std::min_element(entry_cache.begin(), entry_cache.end(), [](const auto& l, const auto& r) {
+			return l.second.last_use < r.second.last_use;
+		});
+		entry_cache_size -= lru->second.data->size();
+		entry_cache.erase(lru);
+	}
+
+	entry_cache_size += data->size();
+	entry_cache[entry] = { std::move(data), ++entry_cache_clock };
 }
 
 bool LzhFilesystem::GetDirectoryContent(StringView path, std::vector<DirectoryTree::Entry>& entries) const {
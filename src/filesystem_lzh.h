@@ -45,6 +45,21 @@ public:
 	 */
 	LzhFilesystem(std::string base_path, FilesystemView parent_fs, StringView encoding = "");
 
+	/** Logs the statistics of the entry cache */
+	~LzhFilesystem() override;
+
+	struct CacheStats {
+		/** Opens served from the entry cache */
+		uint64_t hits = 0;
+		/** Opens that decompressed the entry */
+		uint64_t misses = 0;
+		/** Total number of decompressed bytes */
+		uint64_t bytes_inflated = 0;
+	};
+
+	/** @return statistics of the entry cache */
+	const CacheStats& GetCacheStats() const;
+
 protected:
 	/**
  	 * Implementation of abstract methods
@@ -88,11 +103,32 @@ private:
 		}
 	};
 
+	/**
+	 * Decompressed entries, shared by all streams opened on them.
+	 * Least recently used entries are evicted when the cache exceeds its limit.
+	 */
+	struct CachedEntry {
+		std::shared_ptr<const std::vector<uint8_t>> data;
+		uint64_t last_use = 0;
+	};
+
+	std::shared_ptr<const std::vector<uint8_t>> Decompress(const LzhEntry& entry, StringView path) const;
+	void AddToCache(const LzhEntry* entry, std::shared_ptr<const std::vector<uint8_t>> data) const;
+
+	mutable std::unordered_map<const LzhEntry*, CachedEntry> entry_cache;
+	mutable size_t entry_cache_size = 0;
+	mutable uint64_t entry_cache_clock = 0;
+	mutable CacheStats cache_stats;
+
 	mutable Filesystem_Stream::InputStream is;
 	mutable std::unique_ptr<LHAInputStream, LhasaDeleter> lha_is;
 	mutable std::unique_ptr<LHAReader, LhasaDeleter> lha_reader;
 };
 
+inline const LzhFilesystem::CacheStats& LzhFilesystem::GetCacheStats() const {
+	return cache_stats;
+}
+
 #endif
 
 #endif
@@ -119,8 +119,16 @@ bool NativeFilesystem::MakeDirectory(StringView path, bool follow_symlinks) cons
 	return Platform::File(ToString(path)).MakeDirectory(follow_symlinks);
 }
 
+bool NativeFilesystem::RenameFile(StringView from, StringView to) const {
+	return Platform::File(ToString(from)).Rename(ToString(to));
+}
+
+bool NativeFilesystem::RemoveFile(StringView path) const {
+	return Platform::File(ToString(path)).Remove();
+}
+
 bool NativeFilesystem::IsFeatureSupported(Feature f) const {
-	return f == Filesystem::Feature::Write;
+	return f == Filesystem::Feature::Write || f == Filesystem::Feature::Rename;
 }
 
 std::string NativeFilesystem::Describe() const {
@@ -112,3 +112,9 @@ Filesystem_Stream::InputMemoryStreamBuf::InputMemoryStreamBuf(std::vector<uint8_
 		: InputMemoryStreamBufView(buffer), buffer(std::move(buffer)) {
 
 }
+
+// The view is only read from, the const_cast does not modify the shared buffer
+Filesystem_Stream::InputSharedMemoryStreamBuf::InputSharedMemoryStreamBuf(std::shared_ptr<const std::vector<uint8_t>> buffer)
+		: InputMemoryStreamBufView(Span<uint8_t>(const_cast<uint8_t*>(buffer->data()), buffer->size())), buffer(std::move(buffer)) {
+
+}
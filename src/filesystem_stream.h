@@ -21,6 +21,7 @@
 // Headers
 #include <cassert>
 #include <istream>
+#include <memory>
 #include <ostream>
 #include "filesystem.h"
 #include "utils.h"
@@ -93,6 +94,17 @@ namespace Filesystem_Stream {
 		std::vector<uint8_t> buffer;
 	};
 
+	/** Streambuf interface for an in-memory buffer. Shares ownership of the buffer, e.g. with a cache. */
+	class InputSharedMemoryStreamBuf : public InputMemoryStreamBufView {
+	public:
+		explicit InputSharedMemoryStreamBuf(std::shared_ptr<const std::vector<uint8_t>> buffer);
+		InputSharedMemoryStreamBuf(InputSharedMemoryStreamBuf const& other) = delete;
+		InputSharedMemoryStreamBuf const& operator=(InputSharedMemoryStreamBuf const& other) = delete;
+
+	private:
+		std::shared_ptr<const std::vector<uint8_t>> buffer;
+	};
+
 	static constexpr std::ios_base::seekdir CSeekdirToCppSeekdir(int origin);
 
 	static constexpr int CppSeekdirToCSeekdir(std::ios_base::seekdir origin);
@@ -24,11 +24,19 @@
 #include "input.h"
 #include "font.h"
 #include "drawable_mgr.h"
+#include "frame_stats.h"
 
 using namespace std::chrono_literals;
 
 static constexpr auto refresh_frequency = 1s;
 
+// Height of the frame time histogram
+static constexpr int histogram_height = 16;
+
+static std::string FormatMs(Game_Clock::duration d) {
+	return fmt::format("{:.1f}", std::chrono::duration<float, std::milli>(d).count());
+}
+
 FpsOverlay::FpsOverlay() :
 	Drawable(Priority_Overlay + 100, Drawable::Flags::Global)
 {
@@ -41,6 +49,23 @@ void FpsOverlay::UpdateText() {
 	auto fps = Utils::RoundTo<int>(Game_Clock::GetFPS());
 	text = "FPS: " + std::to_string(fps);
 	fps_dirty = true;
+
+	if (FrameStats::IsEnabled()) {
+		auto summary = FrameStats::GetSummary();
+		const auto& phase = summary.phase_avg;
+
+		stats_text = {
+			fmt::format("U {} D {} P {} S {}",
+				FormatMs(phase[static_cast<int>(FrameStats::Phase::Update)]),
+				FormatMs(phase[static_cast<int>(FrameStats::Phase::Draw)]),
+				FormatMs(phase[static_cast<int>(FrameStats::Phase::Present)]),
+				FormatMs(phase[static_cast<int>(FrameStats::Phase::Sleep)])),
+			fmt::format("p99 {} max {}", FormatMs(summary.frame_p99), FormatMs(summary.frame_max)),
+			fmt::format("miss {} steps {}-{} px {}", summary.missed, summary.steps_min, summary.steps_max, summary.redrawn_pixels_avg)
+		};
+		stats_histogram = summary.histogram;
+		stats_dirty = true;
+	}
 }
 
 bool FpsOverlay::Update() {
@@ -82,6 +107,13 @@ void FpsOverlay::Draw(Bitmap& dst) {
 		}
 
 		dst.Blit(1, 2, *fps_bitmap, fps_rect, 255);
+
+		if (FrameStats::IsEnabled()) {
+			if (stats_dirty) {
+				DrawStats();
+			}
+			dst.Blit(1, 2 + fps_rect.height + 1, *stats_bitmap, stats_bitmap->GetRect(), 255);
+		}
 	}
 
 	// Always drawn when speedup is on independent of FPS
@@ -109,3 +141,39 @@ void FpsOverlay::Draw(Bitmap& dst) {
 	}
 }
 
+void FpsOverlay::DrawStats() {
+	auto& font = *Font::DefaultBitmapFont();
+
+	int width = FrameStats::num_buckets * 2;
+	int line_height = 0;
+	for (auto& line: stats_text) {
+		Rect rect = Text::GetSize(font, line);
+		width = std::max(width, rect.width);
+		line_height = rect.height - 1;
+	}
+	const int height = line_height * static_cast<int>(stats_text.size()) + histogram_height + 1;
+
+	if (!stats_bitmap || stats_bitmap->GetWidth() != width + 1 || stats_bitmap->GetHeight() != height) {
+		stats_bitmap = Bitmap::Create(width + 1, height, true);
+	}
+	stats_bitmap->Clear();
+	stats_bitmap->Fill(Color(0, 0, 0, 128));
+
+	int y = 0;
+	for (auto& line: stats_text) {
+		Text::Draw(*stats_bitmap, 1, y, font, Color(255, 255, 255, 255), line);
+		y += line_height;
+	}
+
+	// Histogram of the frame times, one bar per bucket
+	const int max_count = *std::max_element(stats_histogram.begin(), stats_histogram.end());
+	if (max_count > 0) {
+		for (int i = 0; i < FrameStats::num_buckets; ++i) {
+			const int bar = (stats_histogram[i] * histogram_height + max_count - 1) / max_count;
+			const auto color = (i == FrameStats::num_buckets - 1) ? Color(255, 96, 96, 255) : Color(255, 255, 255, 255);
+			stats_bitmap->FillRect(Rect(1 + i * 2, y + histogram_height - bar, 2, bar), color);
+		}
+	}
+
+	stats_dirty = false;
+}
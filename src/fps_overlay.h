@@ -18,9 +18,12 @@
 #ifndef EP_FPS_OVERLAY_H
 #define EP_FPS_OVERLAY_H
 
+#include <array>
 #include <deque>
 #include <string>
+#include <vector>
 #include "drawable.h"
+#include "frame_stats.h"
 #include "memory_management.h"
 #include "rect.h"
 #include "game_clock.h"
@@ -28,6 +31,7 @@
 /**
  * FpsOverlay class.
  * Shows current FPS and the speedup indicator.
+ * When FrameStats are enabled the frame pacing statistics are shown below the FPS.
  */
 class FpsOverlay : public Drawable {
 public:
@@ -58,9 +62,11 @@ public:
 
 private:
 	void UpdateText();
+	void DrawStats();
 
 	BitmapRef fps_bitmap;
 	BitmapRef speedup_bitmap;
+	BitmapRef stats_bitmap;
 	Game_Clock::time_point last_refresh_time;
 
 	/** Rect to draw on screen */
@@ -68,10 +74,13 @@ private:
 	Rect speedup_rect;
 
 	std::string text;
+	std::vector<std::string> stats_text;
+	std::array<int, FrameStats::num_buckets> stats_histogram = {};
 
 	int last_speed_mod = 1;
 	bool speedup_dirty = true;
 	bool fps_dirty = true;
+	bool stats_dirty = true;
 	bool draw_fps = true;
 };
 
@@ -0,0 +1,311 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "frame_capture.h"
+#include "bitmap.h"
+#include "filefinder.h"
+#include "filesystem_stream.h"
+#include "game_clock.h"
+#include "image_png.h"
+#include "output.h"
+#include "utils.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <vector>
+#ifdef HAVE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace {
+	/** Encoder threads for PNG files, a video is encoded by one thread to keep the frame order */
+	constexpr int num_png_threads = 2;
+
+	struct Buffer {
+		/** Pixels as returned by Bitmap::ReadPixelsRGB */
+		std::vector<uint32_t> pixels;
+		int width = 0;
+		int height = 0;
+		int frame = 0;
+	};
+
+	bool enabled = false;
+	bool video = false;
+	std::string capture_path;
+	int capture_interval = 1;
+	int frame_counter = 0;
+
+	std::array<Buffer, FrameCapture::num_buffers> buffers;
+	/** Buffers that can be filled by the main thread */
+	std::vector<int> free_buffers;
+	/** Buffers waiting for an encoder thread */
+	std::deque<int> queued_buffers;
+
+	std::atomic<int> written_frames { 0 };
+	int dropped_frames = 0;
+
+	std::unique_ptr<Filesystem_Stream::OutputStream> video_stream;
+	int video_width = 0;
+	int video_height = 0;
+	bool video_header_written = false;
+
+#ifdef HAVE_THREADS
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable cv;
+	bool quit = false;
+#endif
+
+	/**
+	 * Opens a PNG file without the filesystem abstraction,
+	 * the directory caches are not thread-safe.
+	 */
+	bool WritePNGFile(const Buffer& buffer) {
+		const auto name = FileFinder::MakePath(capture_path, fmt::format("frame_{:06d}.png", buffer.frame));
+
+		auto* buf = new std::filebuf();
+		buf->open(
+#ifdef _MSC_VER
+			Utils::ToWideString(name),
+#else
+			name,
+#endif
+			std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+		if (!buf->is_open()) {
+			delete buf;
+			Output::Warning("FrameCapture: Không thể ghi tệp tin {}", name);
+			return false;
+		}
+
+		Filesystem_Stream::OutputStream os(buf, FilesystemView(), name);
+		return ImagePNG::WritePNG(os, buffer.width, buffer.height, const_cast<uint32_t*>(buffer.pixels.data()));
+	}
+
+	/** Appends a frame to the Y4M video, converts to BT.601 YCbCr 4:4:4 */
+	bool WriteVideoFrame(const Buffer& buffer, std::vector<uint8_t>& planes) {
+		auto& os = *video_stream;
+
+		if (!video_header_written) {
+			const auto fps = std::chrono::duration_cast<Game_Clock::duration>(std::chrono::seconds(1)) / Game_Clock::GetTargetGameTimeStep();
+			os << "YUV4MPEG2 W" << buffer.width << " H" << buffer.height
+				<< " F" << fps << ':' << capture_interval << " Ip A1:1 C444\n";
+			video_header_written = true;
+		}
+
+		const size_t plane_size = static_cast<size_t>(buffer.width) * buffer.height;
+		planes.resize(plane_size * 3);
+		uint8_t* y_plane = planes.data();
+		uint8_t* u_plane = y_plane + plane_size;
+		uint8_t* v_plane = u_plane + plane_size;
+
+		for (int y = 0; y < buffer.height; ++y) {
+			const auto* src = reinterpret_cast<const uint8_t*>(buffer.pixels.data() + y * buffer.width);
+			for (int x = 0; x < buffer.width; ++x) {
+				const int r = src[0];
+				const int g = src[1];
+				const int b = src[2];
+				src += 3;
+
+				*y_plane++ = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+				*u_plane++ = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+				*v_plane++ = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+			}
+		}
+
+		os << "FRAME\n";
+		os.write(reinterpret_cast<const char*>(planes.data()), planes.size());
+		return os.good();
+	}
+
+	void Encode(const Buffer& buffer, std::vector<uint8_t>& planes) {
+		bool success = video ? WriteVideoFrame(buffer, planes) : WritePNGFile(buffer);
+		if (success) {
+			++written_frames;
+		}
+	}
+
+#ifdef HAVE_THREADS
+	void WorkerMain() {
+		std::vector<uint8_t> planes;
+
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			cv.wait(lock, [] { return !queued_buffers.empty() || quit; });
+			if (queued_buffers.empty()) {
+				break;
+			}
+
+			const int index = queued_buffers.front();
+			queued_buffers.pop_front();
+			lock.unlock();
+
+			Encode(buffers[index], planes);
+
+			lock.lock();
+			free_buffers.push_back(index);
+		}
+	}
+#endif
+}
+
+void FrameCapture::Init(const std::string& path, int interval) {
+	Quit();
+
+	capture_path = path;
+	capture_interval = std::max(interval, 1);
+	video = StringView(Utils::LowerCase(path)).ends_with(".y4m");
+	frame_counter = 0;
+	written_frames = 0;
+	dropped_frames = 0;
+
+	if (video) {
+		video_stream = std::make_unique<Filesystem_Stream::OutputStream>(FileFinder::Root().OpenOutputStream(path, std::ios::out | std::ios::binary | std::ios::trunc));
+		if (!*video_stream) {
+			Output::Warning("FrameCapture: Không thể mở tệp tin {}", path);
+			video_stream.reset();
+			return;
+		}
+		video_width = 0;
+		video_height = 0;
+		video_header_written = false;
+	} else if (!FileFinder::Root().MakeDirectory(path, false)) {
+		Output::Warning("FrameCapture: Không thể tạo thư mục {}", path);
+		return;
+	}
+
+	free_buffers.clear();
+	for (int i = num_buffers - 1; i >= 0; --i) {
+		free_buffers.push_back(i);
+	}
+
+#ifdef HAVE_THREADS
+	quit = false;
+	const int num_threads = video ? 1 : num_png_threads;
+	for (int i = 0; i < num_threads; ++i) {
+		workers.emplace_back(WorkerMain);
+	}
+#endif
+
+	enabled = true;
+	Output::Debug("FrameCapture: Writing frames to {} (interval {})", path, capture_interval);
+}
+
+void FrameCapture::Quit() {
+	if (!enabled) {
+		return;
+	}
+
+#ifdef HAVE_THREADS
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+	}
+	cv.notify_all();
+
+	for (auto& worker: workers) {
+		worker.join();
+	}
+	workers.clear();
+#endif
+
+	if (video_stream) {
+		video_stream->flush();
+		video_stream.reset();
+	}
+
+	for (auto& buffer: buffers) {
+		buffer.pixels = {};
+	}
+
+	enabled = false;
+	Output::Debug("FrameCapture: {} frames written, {} dropped", written_frames.load(), dropped_frames);
+}
+
+bool FrameCapture::IsEnabled() {
+	return enabled;
+}
+
+void FrameCapture::Capture(const Bitmap& frame) {
+	if (!enabled) {
+		return;
+	}
+
+	const int frame_number = frame_counter++;
+	if (frame_number % capture_interval != 0) {
+		return;
+	}
+
+	if (video) {
+		if (video_width == 0) {
+			video_width = frame.GetWidth();
+			video_height = frame.GetHeight();
+		} else if (frame.GetWidth() != video_width || frame.GetHeight() != video_height) {
+			// A video cannot change the resolution
+			++dropped_frames;
+			return;
+		}
+	}
+
+	int index;
+	{
+#ifdef HAVE_THREADS
+		std::lock_guard<std::mutex> lock(mutex);
+#endif
+		if (free_buffers.empty()) {
+			++dropped_frames;
+			return;
+		}
+		index = free_buffers.back();
+		free_buffers.pop_back();
+	}
+
+	// The buffer is owned by the main thread until it is queued
+	auto& buffer = buffers[index];
+	buffer.width = frame.GetWidth();
+	buffer.height = frame.GetHeight();
+	buffer.frame = frame_number;
+	buffer.pixels.resize(static_cast<size_t>(buffer.width) * buffer.height);
+	frame.ReadPixelsRGB(buffer.pixels.data());
+
+#ifdef HAVE_THREADS
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		queued_buffers.push_back(index);
+	}
+	cv.notify_one();
+#else
+	std::vector<uint8_t> planes;
+	Encode(buffer, planes);
+	free_buffers.push_back(index);
+#endif
+}
+
+int FrameCapture::GetWrittenFrames() {
+	return written_frames;
+}
+
+int FrameCapture::GetDroppedFrames() {
+	return dropped_frames;
+}
@@ -0,0 +1,70 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_FRAME_CAPTURE_H
+#define EP_FRAME_CAPTURE_H
+
+// Headers
+#include <string>
+
+class Bitmap;
+
+/**
+ * Records the presented frames.
+ *
+ * Player::Draw hands every frame to Capture. Every Nth frame is copied into
+ * one of num_buffers reused buffers and encoded by background threads
+ * to numbered PNG files or appended to an uncompressed Y4M video (4:4:4).
+ * When all buffers are still being encoded the frame is dropped instead of
+ * stalling the game loop, the number of a PNG file is the number of the
+ * presented frame, dropped frames leave gaps.
+ *
+ * Without thread support the frames are encoded immediately.
+ */
+namespace FrameCapture {
+	/** Number of frame buffers */
+	constexpr int num_buffers = 8;
+
+	/**
+	 * Starts capturing.
+	 *
+	 * @param path file ending with .y4m for a video, otherwise a directory for PNG files
+	 * @param interval capture every interval-th frame
+	 */
+	void Init(const std::string& path, int interval);
+
+	/** Encodes the remaining frames and stops capturing */
+	void Quit();
+
+	/** @return whether frames are captured */
+	bool IsEnabled();
+
+	/**
+	 * Captures a presented frame when it is due.
+	 *
+	 * @param frame the frame
+	 */
+	void Capture(const Bitmap& frame);
+
+	/** @return number of frames written */
+	int GetWrittenFrames();
+
+	/** @return number of frames dropped because no buffer was free or the size changed */
+	int GetDroppedFrames();
+}
+
+#endif
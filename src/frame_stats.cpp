@@ -0,0 +1,206 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "frame_stats.h"
+#include "filefinder.h"
+#include "filesystem_stream.h"
+#include "output.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+	constexpr int num_phases = static_cast<int>(FrameStats::Phase::Count);
+
+	struct Frame {
+		Game_Clock::duration frame = {};
+		std::array<Game_Clock::duration, num_phases> phases = {};
+		int steps = 0;
+		int redrawn_pixels = 0;
+		bool missed = false;
+	};
+
+	bool enabled = false;
+	std::unique_ptr<Filesystem_Stream::OutputStream> csv;
+	int csv_frame = 0;
+
+	// Ring buffer of the last frames
+	std::array<Frame, FrameStats::window_size> frames;
+	int num_frames = 0;
+	int next_frame = 0;
+	std::array<int, FrameStats::num_buckets> histogram = {};
+
+	// Frame in progress
+	bool in_frame = false;
+	Frame current;
+	Game_Clock::time_point frame_start;
+	Game_Clock::time_point last_mark;
+	Game_Clock::duration frame_target = {};
+
+	int GetBucket(Game_Clock::duration frame) {
+		return std::min<int>(static_cast<int>(frame / FrameStats::bucket_width), FrameStats::num_buckets - 1);
+	}
+
+	long long ToMicroseconds(Game_Clock::duration d) {
+		return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+	}
+
+	void Reset() {
+		num_frames = 0;
+		next_frame = 0;
+		histogram = {};
+		in_frame = false;
+	}
+
+	void AddFrame(const Frame& frame) {
+		if (num_frames == FrameStats::window_size) {
+			--histogram[GetBucket(frames[next_frame].frame)];
+		} else {
+			++num_frames;
+		}
+
+		frames[next_frame] = frame;
+		next_frame = (next_frame + 1) % FrameStats::window_size;
+		++histogram[GetBucket(frame.frame)];
+
+		if (csv) {
+			auto& os = *csv;
+			os << csv_frame++ << ',' << ToMicroseconds(frame.frame);
+			for (auto& phase: frame.phases) {
+				os << ',' << ToMicroseconds(phase);
+			}
+			os << ',' << frame.steps << ',' << frame.redrawn_pixels << ',' << (frame.missed ? 1 : 0) << '\n';
+		}
+	}
+}
+
+void FrameStats::Init(const std::string& csv_path) {
+	Reset();
+	enabled = true;
+
+	if (!csv_path.empty()) {
+		csv = std::make_unique<Filesystem_Stream::OutputStream>(FileFinder::Root().OpenOutputStream(csv_path, std::ios::out | std::ios::trunc));
+		if (!*csv) {
+			Output::Warning("Không thể mở tệp tin {} để ghi thống kê khung hình: {}", csv_path, strerror(errno));
+			csv.reset();
+			return;
+		}
+
+		*csv << "frame,frame_us,update_us,draw_us,present_us,sleep_us,steps,redrawn_px,missed\n";
+	}
+}
+
+void FrameStats::Quit() {
+	enabled = false;
+	Reset();
+
+	if (csv) {
+		csv->flush();
+		csv.reset();
+	}
+}
+
+bool FrameStats::IsEnabled() {
+	return enabled;
+}
+
+void FrameStats::BeginFrame(Game_Clock::time_point now, Game_Clock::duration target) {
+	if (!enabled) {
+		return;
+	}
+
+	if (in_frame) {
+		current.phases[static_cast<int>(Phase::Sleep)] = now - last_mark;
+		current.frame = now - frame_start;
+		current.missed = frame_target > Game_Clock::duration(0) && current.frame * 2 > frame_target * 3;
+		AddFrame(current);
+	}
+
+	in_frame = true;
+	current = {};
+	frame_start = now;
+	last_mark = now;
+	frame_target = target;
+}
+
+void FrameStats::EndPhase(Phase phase) {
+	if (!enabled || !in_frame) {
+		return;
+	}
+
+	const auto now = Game_Clock::now();
+	current.phases[static_cast<int>(phase)] += now - last_mark;
+	last_mark = now;
+}
+
+void FrameStats::SetSteps(int steps) {
+	current.steps = steps;
+}
+
+void FrameStats::AddRedrawnPixels(int pixels) {
+	if (!enabled) {
+		return;
+	}
+
+	current.redrawn_pixels += pixels;
+}
+
+FrameStats::Summary FrameStats::GetSummary() {
+	Summary summary;
+	summary.frames = num_frames;
+	summary.histogram = histogram;
+
+	if (num_frames == 0) {
+		return summary;
+	}
+
+	std::vector<Game_Clock::duration> frame_times;
+	frame_times.reserve(num_frames);
+
+	summary.steps_min = frames[0].steps;
+	summary.steps_max = frames[0].steps;
+	long long redrawn_pixels = 0;
+
+	for (int i = 0; i < num_frames; ++i) {
+		const auto& frame = frames[i];
+		for (int p = 0; p < num_phases; ++p) {
+			summary.phase_avg[p] += frame.phases[p];
+		}
+		summary.frame_avg += frame.frame;
+		summary.frame_max = std::max(summary.frame_max, frame.frame);
+		summary.missed += frame.missed ? 1 : 0;
+		summary.steps_min = std::min(summary.steps_min, frame.steps);
+		summary.steps_max = std::max(summary.steps_max, frame.steps);
+		redrawn_pixels += frame.redrawn_pixels;
+		frame_times.push_back(frame.frame);
+	}
+
+	for (auto& phase: summary.phase_avg) {
+		phase /= num_frames;
+	}
+	summary.frame_avg /= num_frames;
+	summary.redrawn_pixels_avg = static_cast<int>(redrawn_pixels / num_frames);
+
+	auto p99 = frame_times.begin() + (frame_times.size() * 99) / 100;
+	std::nth_element(frame_times.begin(), p99, frame_times.end());
+	summary.frame_p99 = *p99;
+
+	return summary;
+}
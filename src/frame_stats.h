@@ -0,0 +1,124 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_FRAME_STATS_H
+#define EP_FRAME_STATS_H
+
+// Headers
+#include <array>
+#include <string>
+#include "game_clock.h"
+
+/**
+ * Frame pacing statistics.
+ *
+ * Player::MainLoop reports how long every frame spent updating the game
+ * logic, drawing, presenting and sleeping. The statistics of the last frames
+ * are shown by the FpsOverlay and every frame can be written to a CSV file.
+ * Average FPS hides stutter, the histogram of the frame times shows it.
+ */
+namespace FrameStats {
+	enum class Phase {
+		/** Game logic, including input */
+		Update,
+		/** Rendering into the display surface */
+		Draw,
+		/** Presenting the display surface (UpdateDisplay, can block for vsync) */
+		Present,
+		/** Sleeping until the next frame */
+		Sleep,
+		Count
+	};
+
+	/** Number of frames the statistics are computed from */
+	constexpr int window_size = 240;
+
+	/** Width of a histogram bucket */
+	constexpr auto bucket_width = std::chrono::milliseconds(2);
+
+	/** Number of histogram buckets, the last bucket contains all longer frames */
+	constexpr int num_buckets = 25;
+
+	struct Summary {
+		/** Number of frames the summary is computed from */
+		int frames = 0;
+		/** Average time per phase */
+		std::array<Game_Clock::duration, static_cast<int>(Phase::Count)> phase_avg = {};
+		/** Average time between the start of two frames */
+		Game_Clock::duration frame_avg = {};
+		/** 99th percentile of the frame time */
+		Game_Clock::duration frame_p99 = {};
+		/** Longest frame */
+		Game_Clock::duration frame_max = {};
+		/** Frames that took longer than 1.5 times the target frame time */
+		int missed = 0;
+		/** Fewest and most logical steps in a frame */
+		int steps_min = 0;
+		int steps_max = 0;
+		/** Average number of window content pixels redrawn per frame */
+		int redrawn_pixels_avg = 0;
+		/** Number of frames per frame time bucket */
+		std::array<int, num_buckets> histogram = {};
+	};
+
+	/**
+	 * Enables the statistics.
+	 *
+	 * @param csv_path when not empty the file is overwritten and every frame is written to it
+	 */
+	void Init(const std::string& csv_path);
+
+	/** Disables the statistics and closes the CSV file */
+	void Quit();
+
+	/** @return whether the statistics are enabled */
+	bool IsEnabled();
+
+	/**
+	 * Starts a new frame and completes the previous one.
+	 * The time since the last phase of the previous frame counts as sleep.
+	 *
+	 * @param now start time of the frame
+	 * @param target intended time between two frames
+	 */
+	void BeginFrame(Game_Clock::time_point now, Game_Clock::duration target);
+
+	/**
+	 * Ends a phase of the current frame, the phase started when the
+	 * previous phase ended.
+	 *
+	 * @param phase phase that ended
+	 */
+	void EndPhase(Phase phase);
+
+	/**
+	 * @param steps number of logical steps executed in the current frame
+	 */
+	void SetSteps(int steps);
+
+	/**
+	 * Counts pixels of window contents that were redrawn in the current frame.
+	 *
+	 * @param pixels number of pixels
+	 */
+	void AddRedrawnPixels(int pixels);
+
+	/** @return statistics of the last window_size frames */
+	Summary GetSummary();
+}
+
+#endif
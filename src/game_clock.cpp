@@ -29,12 +29,23 @@ Game_Clock::Data Game_Clock::data;
 static constexpr auto _fps_smooth = 2.0f / 121.0f;
 
 Game_Clock::duration Game_Clock::OnNextFrame(time_point now) {
-	const auto mfa = std::chrono::duration_cast<duration>(data.max_frame_accumulator * data.speed);
-
 	const auto dt = now - data.frame_time;
 	data.frame_time = now;
-	data.frame_accumulator += std::chrono::duration_cast<duration>(dt * data.speed);
-	data.frame_accumulator = std::min(data.frame_accumulator, mfa);
+
+	if (IsUnlimitedSpeed()) {
+		// Report how much faster than realtime the previous frame ran
+		if (data.unlimited_steps > 0 && dt > duration::zero()) {
+			data.speed = std::chrono::duration<float>(GetTargetGameTimeStep() * data.unlimited_steps).count()
+				/ std::chrono::duration<float>(dt).count();
+		}
+		data.unlimited_steps = 0;
+		data.frame_accumulator = {};
+	} else {
+		const auto mfa = std::chrono::duration_cast<duration>(data.max_frame_accumulator * data.speed);
+
+		data.frame_accumulator += std::chrono::duration_cast<duration>(dt * data.speed);
+		data.frame_accumulator = std::min(data.frame_accumulator, mfa);
+	}
 
 	const auto fps = (1.0f / std::chrono::duration<float>(dt).count());
 	data.fps = (data.fps * _fps_smooth) + (fps * (1.0f - _fps_smooth));
@@ -53,6 +64,17 @@ void Game_Clock::ResetFrame(time_point now, bool reset_frame_counter) {
 	}
 }
 
+void Game_Clock::SetUnlimitedSpeed(duration frame_period) {
+	frame_period = std::max(frame_period, duration::zero());
+	if (IsUnlimitedSpeed() && frame_period == duration::zero()) {
+		// Do not catch up on the game time when returning to normal speed
+		data.speed = 1.0;
+		data.frame_accumulator = {};
+	}
+	data.unlimited_frame_period = frame_period;
+	data.unlimited_steps = 0;
+}
+
 void Game_Clock::logClockInfo() {
 	const char* period_name = "custom";
 	if (std::is_same<period,std::nano>::value) {
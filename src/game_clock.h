@@ -76,6 +76,20 @@ public:
 	/** @return the speed up or slowdown factor we'll use to run the game. */
 	static float GetGameSpeedFactor();
 
+	/**
+	 * Enables or disables unlimited speed. When enabled the game time is not bound
+	 * to the real time anymore: Logical steps are run as fast as possible until
+	 * the frame period elapsed. The caller is expected to render only once per
+	 * frame period. The game speed factor reports the measured speed up.
+	 *
+	 * @param frame_period How much real time is simulated between two frames.
+	 *  A zero duration disables unlimited speed.
+	 */
+	static void SetUnlimitedSpeed(duration frame_period);
+
+	/** @return Whether unlimited speed is enabled */
+	static bool IsUnlimitedSpeed();
+
 	/** Get the time of the current frame */
 	static time_point GetFrameTime();
 
@@ -114,9 +128,11 @@ private:
 		time_point frame_time;
 		duration frame_accumulator;
 		duration max_frame_accumulator = std::chrono::duration_cast<duration>(std::chrono::milliseconds(200));
+		duration unlimited_frame_period = {};
 		float speed = 1.0;
 		float fps = 0.0;
 		int frame = 0;
+		int unlimited_steps = 0;
 	};
 	static Data data;
 };
@@ -160,6 +176,15 @@ inline float Game_Clock::GetFPS() {
 }
 
 inline bool Game_Clock::NextGameTimeStep() {
+	if (IsUnlimitedSpeed()) {
+		// Always run at least one step, then as many as fit into the frame period
+		if (data.unlimited_steps > 0 && now() - data.frame_time >= data.unlimited_frame_period) {
+			return false;
+		}
+		++data.unlimited_steps;
+		return true;
+	}
+
 	constexpr auto dt = GetTargetGameTimeStep();
 	if (data.frame_accumulator < dt) {
 		return false;
@@ -180,4 +205,8 @@ inline float Game_Clock::GetGameSpeedFactor() {
 	return data.speed;
 }
 
+inline bool Game_Clock::IsUnlimitedSpeed() {
+	return data.unlimited_frame_period > duration::zero();
+}
+
 #endif
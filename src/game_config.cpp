@@ -54,6 +54,9 @@ void Game_ConfigVideo::Hide() {
 	fps_limit.SetOptionVisible(false);
 	fps_render_window.SetOptionVisible(false);
 	window_zoom.SetOptionVisible(false);
+#ifndef HAVE_THREADS
+	render_threads.SetOptionVisible(false);
+#endif
 	scaling_mode.SetOptionVisible(false);
 	stretch.SetOptionVisible(false);
 	touch_ui.SetOptionVisible(false);
@@ -258,6 +261,12 @@ void Game_Config::LoadFromArgs(CmdlineParser& cp) {
 			video.fps_limit.Set(0);
 			continue;
 		}
+		if (cp.ParseNext(arg, 1, "--render-threads")) {
+			if (arg.ParseValue(0, li_value)) {
+				video.render_threads.Set(li_value);
+			}
+			continue;
+		}
 		if (cp.ParseNext(arg, 0, "--show-fps")) {
 			video.show_fps.Set(true);
 			continue;
@@ -322,6 +331,28 @@ void Game_Config::LoadFromArgs(CmdlineParser& cp) {
 			}
 			continue;
 		}
+		if (cp.ParseNext(arg, 0, "--fast-forward-unlimited")) {
+			player.fast_forward_unlimited.Set(true);
+			continue;
+		}
+		if (cp.ParseNext(arg, 0, "--no-fast-forward-unlimited")) {
+			player.fast_forward_unlimited.Set(false);
+			continue;
+		}
+		if (cp.ParseNext(arg, 0, "--image-cache")) {
+			player.image_cache.Set(true);
+			continue;
+		}
+		if (cp.ParseNext(arg, 0, "--no-image-cache")) {
+			player.image_cache.Set(false);
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--fast-forward-draw-interval")) {
+			if (arg.ParseValue(0, li_value)) {
+				player.fast_forward_draw_interval.Set(li_value);
+			}
+			continue;
+		}
 		if (cp.ParseNext(arg, 1, "--music-volume")) {
 			if (arg.ParseValue(0, li_value)) {
 				audio.music_volume.Set(li_value);
@@ -353,6 +384,7 @@ void Game_Config::LoadFromStream(Filesystem_Stream::InputStream& is) {
 	video.show_fps.FromIni(ini);
 	video.fps_render_window.FromIni(ini);
 	video.fps_limit.FromIni(ini);
+	video.render_threads.FromIni(ini);
 	video.window_zoom.FromIni(ini);
 	video.scaling_mode.FromIni(ini);
 	video.stretch.FromIni(ini);
@@ -423,6 +455,9 @@ void Game_Config::LoadFromStream(Filesystem_Stream::InputStream& is) {
 	player.settings_autosave.FromIni(ini);
 	player.settings_in_title.FromIni(ini);
 	player.settings_in_menu.FromIni(ini);
+	player.fast_forward_unlimited.FromIni(ini);
+	player.fast_forward_draw_interval.FromIni(ini);
+	player.image_cache.FromIni(ini);
 }
 
 void Game_Config::WriteToStream(Filesystem_Stream::OutputStream& os) const {
@@ -434,6 +469,7 @@ void Game_Config::WriteToStream(Filesystem_Stream::OutputStream& os) const {
 	video.show_fps.ToIni(os);
 	video.fps_render_window.ToIni(os);
 	video.fps_limit.ToIni(os);
+	video.render_threads.ToIni(os);
 	video.window_zoom.ToIni(os);
 	video.scaling_mode.ToIni(os);
 	video.stretch.ToIni(os);
@@ -496,6 +532,9 @@ void Game_Config::WriteToStream(Filesystem_Stream::OutputStream& os) const {
 	player.settings_autosave.ToIni(os);
 	player.settings_in_title.ToIni(os);
 	player.settings_in_menu.ToIni(os);
+	player.fast_forward_unlimited.ToIni(os);
+	player.fast_forward_draw_interval.ToIni(os);
+	player.image_cache.ToIni(os);
 
 	os << "\n";
 }
@@ -57,6 +57,9 @@ struct Game_ConfigPlayer {
 	BoolConfigParam settings_autosave{ "Lưu cài đặt khi thoát", "Tự động lưu cài đặt khi thoát", "Player", "SettingsAutosave", false };
 	BoolConfigParam settings_in_title{ "Hiển thị cài đặt ở màn hình bắt đầu", "Hiển thị nút cài đặt ở màn hình bắt đầu", "Player", "SettingsInTitle", false };
 	BoolConfigParam settings_in_menu{ "Hiển thị cài đặt ở màn hình menu", "Hiển thị nút cài đặt ở màn hình menu", "Player", "SettingsInMenu", false };
+	BoolConfigParam fast_forward_unlimited{ "Tua nhanh không giới hạn", "Phím Tua nhanh+ chạy trò chơi nhanh nhất có thể và tắt âm thanh", "Player", "FastForwardUnlimited", false };
+	BoolConfigParam image_cache{ "Bộ nhớ đệm ảnh", "Lưu ảnh đã giải mã ra đĩa để các lần chạy sau tải nhanh hơn. Cần khởi động lại để cập nhật thay đổi.", "Player", "ImageCache", false };
+	RangeConfigParam<int> fast_forward_draw_interval{ "Khoảng vẽ khi tua nhanh", "Số mili giây giữa hai lần vẽ màn hình khi tua nhanh không giới hạn", "Player", "FastForwardDrawInterval", 100, 1, 1000 };
 
 	void Hide();
 };
@@ -68,6 +71,7 @@ struct Game_ConfigVideo {
 	BoolConfigParam show_fps{ "Hiển thị FPS", "Hiển thị bộ đếm Khung hình trên giây (FPS)", "Video", "ShowFps", false };
 	BoolConfigParam fps_render_window{ "Hiển thị FPS ở chế độ cửa sổ", "Hiển thị bộ đếm FPS khi ở chế độ cửa sổ", "Video", "FpsRenderWindow", false };
 	RangeConfigParam<int> fps_limit{ "Giới hạn FPS", "Bật giới hạn Khung hình trên giây (FPS) (nên dùng 60)", "Video", "FpsLimit", DEFAULT_FPS, 0, 99999 };
+	RangeConfigParam<int> render_threads{ "Luồng kết xuất", "Số luồng dùng để vẽ màn hình, mỗi luồng vẽ một dải ngang (1: tắt)", "Video", "RenderThreads", 1, 1, 16 };
 	ConfigParam<int> window_zoom{ "Phóng to cửa sổ", "Chỉnh mức độ phóng to cửa sổ", "Video", "WindowZoom", 2 };
 	EnumConfigParam<ScalingMode, 3> scaling_mode{ "Phương thức chia tỉ lệ", "Màn hình sẽ được phóng to như thế nào", "Video", "ScalingMode", ScalingMode::Nearest,
 		Utils::MakeSvArray("Gần nhất", "Số nguyên", "Song tuyến tính"),
@@ -51,6 +51,7 @@
 #include "scene_settings.h"
 #include "scene.h"
 #include "game_clock.h"
+#include "instrumentation.h"
 #include "input.h"
 #include "main_data.h"
 #include "output.h"
@@ -350,6 +351,8 @@ int Game_Interpreter::GetSubcommandIndex(int indent) const {
 
 // Update
 void Game_Interpreter::Update(bool reset_loop_count) {
+	Instrumentation::ZoneScope zone("Game_Interpreter::Update");
+
 	if (reset_loop_count) {
 		loop_count = 0;
 	}
@@ -519,10 +522,14 @@ void Game_Interpreter::Update(bool reset_loop_count) {
 
 // Setup Starting Event
 void Game_Interpreter::Push(Game_Event* ev) {
+	if (auto* page = ev->GetActivePage()) {
+		Player::translation.RewriteMapPageMessages(*page);
+	}
 	Push(ev->GetList(), ev->GetId(), ev->WasStartedByDecisionKey());
 }
 
 void Game_Interpreter::Push(Game_Event* ev, const lcf::rpg::EventPage* page, bool triggered_by_decision_key) {
+	Player::translation.RewriteMapPageMessages(*page);
 	Push(page->event_commands, ev->GetId(), triggered_by_decision_key);
 }
 
@@ -3874,6 +3881,7 @@ bool Game_Interpreter::CommandCallEvent(lcf::rpg::EventCommand const& com) { //
 		return true;
 	}
 
+	Player::translation.RewriteMapPageMessages(*page);
 	Push(page->event_commands, event->GetId(), false);
 
 	return true;
@@ -4011,6 +4019,7 @@ bool Game_Interpreter::CommandManiacGetSaveInfo(lcf::rpg::EventCommand const& co
 		return true;
 	}
 
+	SaveWriter::Flush();
 	auto savefs = FileFinder::Save();
 	std::string save_name = Scene_Save::GetSaveFilename(savefs, save_number);
 	auto save_stream = FileFinder::Save().OpenInputStream(save_name);
@@ -4111,6 +4120,7 @@ bool Game_Interpreter::CommandManiacLoad(lcf::rpg::EventCommand const& com) {
 	// Not implemented (kinda useless feature):
 	// When com.parameters[2] is 1 the check whether the file exists is skipped
 	// When skipped and missing RPG_RT will crash
+	SaveWriter::Flush();
 	auto savefs = FileFinder::Save();
 	std::string save_name = Scene_Save::GetSaveFilename(savefs, slot);
 	auto save_stream = FileFinder::Save().OpenInputStream(save_name);
@@ -47,6 +47,7 @@
 #include "filefinder.h"
 #include "player.h"
 #include "input.h"
+#include "instrumentation.h"
 #include "utils.h"
 #include "rand.h"
 #include <lcf/scope_guard.h>
@@ -126,6 +127,7 @@ void Game_Map::InitCommonEvents() {
 
 void Game_Map::Dispose() {
 	events.clear();
+	Player::translation.ClearMapMessages();
 	map.reset();
 	map_info = {};
 	panorama = {};
@@ -337,6 +339,8 @@ void Game_Map::SetupCommon() {
 
 		// Translate all messages for this map
 		Player::translation.RewriteMapMessages(ss.str(), *map);
+	} else {
+		Player::translation.ClearMapMessages();
 	}
 	SetNeedRefresh(true);
 
@@ -959,6 +963,8 @@ int Game_Map::CheckEvent(int x, int y) {
 }
 
 void Game_Map::Update(MapUpdateAsyncContext& actx, bool is_preupdate) {
+	Instrumentation::ZoneScope zone("Game_Map::Update");
+
 	if (GetNeedRefresh()) {
 		Refresh();
 	}
@@ -15,6 +15,7 @@
  * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 #include "bitmap.h"
 #include "options.h"
@@ -68,16 +69,19 @@ Game_Pictures::Picture::Picture(lcf::rpg::SavePicture save)
 }
 
 void Game_Pictures::InitGraphics() {
-	for (auto& pic: pictures) {
-		RequestPictureSprite(pic);
+	for (int id: active_pictures) {
+		RequestPictureSprite(pictures[id - 1]);
 	}
 }
 
 void Game_Pictures::SetSaveData(std::vector<lcf::rpg::SavePicture> save)
 {
 	pictures.clear();
+	active_pictures.clear();
 
 	frame_counter = save.empty() ? 0 : save.back().frames;
+	map_frame_counter = 0;
+	battle_frame_counter = 0;
 
 	// Don't create pictures for empty save picture data at the end of the vector.
 	int num_pictures = static_cast<int>(save.size());
@@ -91,6 +95,11 @@ void Game_Pictures::SetSaveData(std::vector<lcf::rpg::SavePicture> save)
 	pictures.reserve(num_pictures);
 	for (int i = 0; i < num_pictures; ++i) {
 		pictures.emplace_back(std::move(save[i]));
+		auto& pic = pictures.back();
+		if (pic.IsActive()) {
+			pic.active = true;
+			active_pictures.push_back(pic.data.ID);
+		}
 	}
 }
 
@@ -102,6 +111,9 @@ std::vector<lcf::rpg::SavePicture> Game_Pictures::GetSaveData() const {
 
 	for (auto& pic: pictures) {
 		save.push_back(pic.data);
+		if (!pic.active) {
+			save.back().frames += GetInactiveFrames(pic);
+		}
 	}
 
 	// RPG_RT Save game data always has a constant number of pictures
@@ -144,6 +156,8 @@ Game_Pictures::Picture& Game_Pictures::GetPicture(int id) {
 		pictures.reserve(id);
 		while (static_cast<int>(pictures.size()) < id) {
 			pictures.emplace_back(pictures.size() + 1);
+			pictures.back().map_frames_mark = map_frame_counter;
+			pictures.back().battle_frames_mark = battle_frame_counter;
 		}
 	}
 	return pictures[id - 1];
@@ -154,8 +168,39 @@ Game_Pictures::Picture* Game_Pictures::GetPicturePtr(int id) {
 		? &pictures[id - 1] : nullptr;
 }
 
+void Game_Pictures::Activate(Picture& pic) {
+	if (pic.active) {
+		return;
+	}
+
+	pic.data.frames += GetInactiveFrames(pic);
+	pic.active = true;
+
+	const int id = pic.data.ID;
+	active_pictures.insert(std::lower_bound(active_pictures.begin(), active_pictures.end(), id), id);
+}
+
+int Game_Pictures::GetInactiveFrames(const Picture& pic) const {
+	// RPG Maker 2k3 1.12 counts the frames of all pictures on the current layer,
+	// for inactive pictures this is done when they are activated or saved
+	if (!Player::IsRPG2k3E()) {
+		return 0;
+	}
+
+	int frames = 0;
+	if (pic.IsOnMap()) {
+		frames += map_frame_counter - pic.map_frames_mark;
+	}
+	if (pic.IsOnBattle()) {
+		frames += battle_frame_counter - pic.battle_frames_mark;
+	}
+	return frames;
+}
+
 void Game_Pictures::OnMapChange() {
-	for (auto& pic: pictures) {
+	// Inactive pictures are already erased
+	for (int id: active_pictures) {
+		auto& pic = pictures[id - 1];
 		if (pic.data.flags.erase_on_map_change) {
 			pic.Erase();
 		}
@@ -163,7 +208,8 @@ void Game_Pictures::OnMapChange() {
 }
 
 void Game_Pictures::OnBattleEnd() {
-	for (auto& pic: pictures) {
+	for (int id: active_pictures) {
+		auto& pic = pictures[id - 1];
 		if (pic.data.flags.erase_on_battle_end) {
 			pic.Erase();
 		}
@@ -246,6 +292,7 @@ bool Game_Pictures::Picture::Show(const ShowParams& params) {
 
 bool Game_Pictures::Show(int id, const ShowParams& params) {
 	auto& pic = GetPicture(id);
+	Activate(pic);
 	if (pic.Show(params)) {
 		if (pic.sprite && !pic.data.name.empty()) {
 			// When the name is empty the current image buffer is reused by ShowPicture command (Used by Yume2kki)
@@ -315,6 +362,7 @@ void Game_Pictures::Picture::Move(const MoveParams& params) {
 
 void Game_Pictures::Move(int id, const MoveParams& params) {
 	auto& pic = GetPicture(id);
+	Activate(pic);
 	pic.Move(params);
 }
 
@@ -338,8 +386,8 @@ void Game_Pictures::Erase(int id) {
 }
 
 void Game_Pictures::EraseAll() {
-	for (auto& pic: pictures) {
-		pic.Erase();
+	for (int id: active_pictures) {
+		pictures[id - 1].Erase();
 	}
 }
 
@@ -376,7 +424,7 @@ void Game_Pictures::RequestPictureSprite(Picture& pic) {
 }
 
 void Game_Pictures::Picture::OnPictureSpriteReady() {
-	auto bitmap = Cache::Picture(data.name, data.use_transparent_color);
+	auto bitmap = Cache::Picture(Cache::Intern(data.name), data.use_transparent_color);
 
 	sprite->SetBitmap(bitmap);
 	sprite->OnPictureShow();
@@ -482,8 +530,9 @@ void Game_Pictures::Picture::OnMapScrolled(int dx16, int dy16) {
 }
 
 void Game_Pictures::OnMapScrolled(int dx, int dy) {
-	for (auto& pic: pictures) {
-		pic.OnMapScrolled(dx, dy);
+	// Pictures fixed to the map are always active
+	for (int id: active_pictures) {
+		pictures[id - 1].OnMapScrolled(dx, dy);
 	}
 }
 
@@ -590,11 +639,54 @@ void Game_Pictures::Picture::Update(bool is_battle) {
 	}
 }
 
+bool Game_Pictures::Picture::IsActive() const {
+	if (!needs_update) {
+		return false;
+	}
+
+	// Shown pictures, including the Yume2kki case of an empty name reusing the old image
+	if (Exists() || IsWindowAttached() || (sprite && sprite->GetBitmap())) {
+		return true;
+	}
+
+	if (!IsOnMap() && !IsOnBattle()) {
+		return false;
+	}
+
+	// Erased pictures continue their movement and effects
+	if (data.fixed_to_map || data.time_left > 0
+			|| data.effect_mode != lcf::rpg::SavePicture::Effect_none
+			|| data.current_effect_power != 0.0) {
+		return true;
+	}
+
+	return Player::IsRPG2k3E() && data.spritesheet_speed > 0;
+}
+
 void Game_Pictures::Update(bool is_battle) {
 	++frame_counter;
-	for (auto& pic: pictures) {
+	if (is_battle) {
+		++battle_frame_counter;
+	} else {
+		++map_frame_counter;
+	}
+
+	// Pictures that became inactive are removed after their last update
+	size_t num_active = 0;
+	for (size_t i = 0; i < active_pictures.size(); ++i) {
+		const int id = active_pictures[i];
+		auto& pic = pictures[id - 1];
 		pic.Update(is_battle);
+
+		if (pic.IsActive()) {
+			active_pictures[num_active++] = id;
+		} else {
+			pic.active = false;
+			pic.map_frames_mark = map_frame_counter;
+			pic.battle_frames_mark = battle_frame_counter;
+		}
 	}
+	active_pictures.resize(num_active);
 }
 
 Game_Pictures::ShowParams Game_Pictures::Picture::GetShowParams() const {
@@ -101,9 +101,20 @@ public:
 		FileRequestBinding request_id;
 		bool needs_update = false;
 		int origin = 0;
+		/** Whether the picture is in the active list of Game_Pictures */
+		bool active = false;
+		/** Map and battle frame counters when the picture became inactive */
+		int map_frames_mark = 0;
+		int battle_frames_mark = 0;
 
 		void Update(bool is_battle);
 
+		/**
+		 * @return whether Update still changes the picture: It is shown, moving,
+		 * has an effect or is fixed to the map. Inactive pictures are skipped by Game_Pictures.
+		 */
+		bool IsActive() const;
+
 		bool IsOnMap() const;
 		bool IsOnBattle() const;
 		int NumSpriteSheetFrames() const;
@@ -136,8 +147,15 @@ private:
 	void RequestPictureSprite(Picture& pic);
 	void OnPictureSpriteReady(FileRequestResult*, int id);
 
+	void Activate(Picture& pic);
+	int GetInactiveFrames(const Picture& pic) const;
+
 	std::vector<Picture> pictures;
+	/** IDs of the pictures that need an update, sorted */
+	std::vector<int> active_pictures;
 	int frame_counter = 0;
+	int map_frame_counter = 0;
+	int battle_frame_counter = 0;
 };
 
 inline bool Game_Pictures::Picture::IsOnMap() const {
@@ -0,0 +1,346 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "game_scanner.h"
+#include "filefinder.h"
+#include "filesystem_native.h"
+#include "filesystem_stream.h"
+#include "game_config.h"
+#include "options.h"
+#include "output.h"
+#include "platform.h"
+#include "utils.h"
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+#include <unordered_set>
+#ifdef HAVE_THREADS
+#include <thread>
+#endif
+#include <lcf/inireader.h>
+#include <lcf/reader_util.h>
+
+namespace {
+	constexpr const char* const cache_filename = "gamebrowser.cache";
+	constexpr const char* const cache_header = "EasyRPG Game Browser Cache 1";
+	// The validation waits for I/O most of the time (e.g. network shares)
+	constexpr int max_threads = 8;
+
+	struct CachedInfo {
+		int64_t mtime = -1;
+		GameScanner::State state = GameScanner::State::Pending;
+		std::string title;
+	};
+
+	// Key is the full path of the candidate
+	std::unordered_map<std::string, CachedInfo> cache;
+	bool cache_loaded = false;
+	bool cache_dirty = false;
+
+	void LoadCache() {
+		if (cache_loaded) {
+			return;
+		}
+		cache_loaded = true;
+
+		auto fs = Game_Config::GetGlobalConfigFilesystem();
+		if (!fs) {
+			return;
+		}
+
+		auto is = fs.OpenInputStream(cache_filename);
+		if (!is) {
+			return;
+		}
+
+		std::string line;
+		if (!Utils::ReadLine(is, line) || line != cache_header) {
+			return;
+		}
+
+		// mtime, state, title and path separated by tabs
+		while (Utils::ReadLine(is, line)) {
+			std::string fields[4];
+			size_t start = 0;
+			int i = 0;
+			for (; i < 3; ++i) {
+				auto end = line.find('\t', start);
+				if (end == std::string::npos) {
+					break;
+				}
+				fields[i] = line.substr(start, end - start);
+				start = end + 1;
+			}
+			fields[3] = line.substr(start);
+
+			int state = atoi(fields[1].c_str());
+			if (i != 3 || fields[3].empty() || state <= static_cast<int>(GameScanner::State::Pending) || state > static_cast<int>(GameScanner::State::Invalid)) {
+				continue;
+			}
+
+			auto& info = cache[fields[3]];
+			info.mtime = std::strtoll(fields[0].c_str(), nullptr, 10);
+			info.state = static_cast<GameScanner::State>(state);
+			info.title = std::move(fields[2]);
+		}
+	}
+
+	void SaveCache() {
+		if (!cache_dirty) {
+			return;
+		}
+		cache_dirty = false;
+
+		auto fs = Game_Config::GetGlobalConfigFilesystem();
+		if (!fs) {
+			return;
+		}
+
+		auto os = fs.OpenOutputStream(cache_filename);
+		if (!os) {
+			Output::Debug("GameScanner: Cannot write {}", cache_filename);
+			return;
+		}
+
+		os << cache_header << '\n';
+		for (auto& kv: cache) {
+			os << kv.second.mtime << '\t' << static_cast<int>(kv.second.state) << '\t' << kv.second.title << '\t' << kv.first << '\n';
+		}
+	}
+
+	std::string RecodeTitle(std::string title) {
+		if (title.empty()) {
+			return title;
+		}
+
+		auto encodings = lcf::ReaderUtil::DetectEncodings(title);
+		if (!encodings.empty()) {
+			auto utf8 = lcf::ReaderUtil::Recode(title, encodings.front());
+			if (!utf8.empty()) {
+				title = std::move(utf8);
+			}
+		}
+
+		// Tabs and line breaks separate the fields of the cache file
+		std::replace_if(title.begin(), title.end(), [](char c) {
+			return c == '\t' || c == '\r' || c == '\n';
+		}, ' ');
+		return title;
+	}
+}
+
+GameScanner::GameScanner(FilesystemView base, std::vector<std::string> names) : base_fs(std::move(base)) {
+	LoadCache();
+
+	shared = std::make_shared<Shared>();
+
+	entries.resize(names.size());
+	for (size_t i = 0; i < names.size(); ++i) {
+		entries[i].name = names[i];
+	}
+	shared->names = std::move(names);
+
+	// Only native directories have a modification time and can be
+	// accessed without the shared filesystem tree
+	if (base_fs && base_fs.IsFeatureSupported(Filesystem::Feature::Write)) {
+		auto path = base_fs.GetFullPath();
+		if (Platform::File(path).IsDirectory(true)) {
+			shared->base_path = std::move(path);
+		}
+	}
+
+	const auto& base_path = shared->base_path;
+	shared->cached_mtimes.resize(entries.size(), -1);
+	if (!base_path.empty()) {
+		for (size_t i = 0; i < entries.size(); ++i) {
+			auto it = cache.find(FileFinder::MakePath(base_path, entries[i].name));
+			if (it != cache.end()) {
+				shared->cached_mtimes[i] = it->second.mtime;
+			}
+		}
+	}
+
+	if (IsFinished()) {
+		RemoveStaleCacheEntries();
+		SaveCache();
+		return;
+	}
+
+#ifdef HAVE_THREADS
+	if (!base_path.empty()) {
+		// The threads are not joined: Stopping a scan must not wait for
+		// validations in progress, e.g. on a slow network share
+		const int num_threads = std::min<int>(max_threads, GetCount());
+		for (int i = 0; i < num_threads; ++i) {
+			std::thread(&GameScanner::WorkerMain, shared).detach();
+		}
+		use_workers = true;
+	}
+#endif
+}
+
+GameScanner::~GameScanner() {
+#ifdef HAVE_THREADS
+	shared->cancel = true;
+#endif
+
+	SaveCache();
+}
+
+std::vector<int> GameScanner::Poll() {
+	std::vector<int> updated;
+
+#ifdef HAVE_THREADS
+	if (use_workers) {
+		std::vector<Result> done;
+		{
+			std::lock_guard<std::mutex> lock(shared->mutex);
+			done.swap(shared->results);
+		}
+
+		for (auto& result: done) {
+			updated.push_back(result.index);
+			Apply(std::move(result));
+		}
+	} else
+#endif
+	if (next_index < GetCount()) {
+		auto result = Validate(*shared, base_fs, next_index++);
+		updated.push_back(result.index);
+		Apply(std::move(result));
+	}
+
+	if (!updated.empty() && IsFinished()) {
+		RemoveStaleCacheEntries();
+		SaveCache();
+	}
+
+	return updated;
+}
+
+GameScanner::Result GameScanner::Validate(const Shared& data, const FilesystemView& base, int index) {
+	Result result;
+	result.index = index;
+
+	const auto& name = data.names[index];
+
+	if (!data.base_path.empty()) {
+		result.mtime = Platform::File(FileFinder::MakePath(data.base_path, name)).GetModificationTime();
+		if (result.mtime >= 0 && result.mtime == data.cached_mtimes[index]) {
+			result.from_cache = true;
+			return result;
+		}
+	}
+
+	auto fs = base.Create(name);
+	if (!fs) {
+		result.state = State::Invalid;
+		return result;
+	}
+
+	if (!FileFinder::IsValidProject(fs)) {
+		result.state = State::Folder;
+		return result;
+	}
+
+	result.state = State::Game;
+
+	auto ini_stream = fs.OpenInputStream(fs.FindFile(INI_NAME), std::ios_base::in);
+	if (ini_stream) {
+		lcf::INIReader ini(ini_stream);
+		if (ini.ParseError() != -1) {
+			result.title = ini.Get("RPG_RT", "GameTitle", "");
+		}
+	}
+
+	return result;
+}
+
+void GameScanner::Apply(Result result) {
+	auto& entry = entries[result.index];
+	const auto& base_path = shared->base_path;
+	const auto key = base_path.empty() ? std::string() : FileFinder::MakePath(base_path, entry.name);
+
+	if (result.from_cache) {
+		auto it = cache.find(key);
+		if (it != cache.end()) {
+			entry.state = it->second.state;
+			entry.title = it->second.title;
+		} else {
+			entry.state = State::Folder;
+		}
+	} else {
+		entry.state = result.state;
+		entry.title = RecodeTitle(std::move(result.title));
+
+		if (!key.empty() && result.mtime >= 0) {
+			auto& info = cache[key];
+			info.mtime = result.mtime;
+			info.state = entry.state;
+			info.title = entry.title;
+			cache_dirty = true;
+		}
+	}
+
+	++resolved;
+}
+
+void GameScanner::RemoveStaleCacheEntries() {
+	const auto& base_path = shared->base_path;
+	if (base_path.empty()) {
+		return;
+	}
+
+	std::unordered_set<std::string> keys;
+	for (auto& entry: entries) {
+		keys.insert(FileFinder::MakePath(base_path, entry.name));
+	}
+
+	for (auto it = cache.begin(); it != cache.end();) {
+		// Only direct children of the scanned directory
+		const auto filename = FileFinder::GetPathAndFilename(it->first).second;
+		if (!filename.empty() && keys.count(it->first) == 0 && FileFinder::MakePath(base_path, filename) == it->first) {
+			it = cache.erase(it);
+			cache_dirty = true;
+		} else {
+			++it;
+		}
+	}
+}
+
+#ifdef HAVE_THREADS
+void GameScanner::WorkerMain(std::shared_ptr<Shared> data) {
+	// The caches of the shared filesystem tree are not thread-safe,
+	// every worker uses its own filesystem.
+	auto native_fs = std::make_shared<NativeFilesystem>("", FilesystemView());
+	auto base = native_fs->Subtree(data->base_path);
+	const int count = static_cast<int>(data->names.size());
+
+	while (!data->cancel) {
+		const int index = data->next_index++;
+		if (index >= count) {
+			return;
+		}
+
+		auto result = Validate(*data, base, index);
+
+		std::lock_guard<std::mutex> lock(data->mutex);
+		data->results.push_back(std::move(result));
+	}
+}
+#endif
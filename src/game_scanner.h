@@ -0,0 +1,155 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_GAME_SCANNER_H
+#define EP_GAME_SCANNER_H
+
+// Headers
+#include "system.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#ifdef HAVE_THREADS
+#include <atomic>
+#include <mutex>
+#endif
+#include "filesystem.h"
+
+/**
+ * Validates the entries of a game browser directory.
+ *
+ * Every candidate (directory or archive) is checked with
+ * FileFinder::IsValidProject and the title of valid games is read from
+ * RPG_RT.ini. On native filesystems the candidates are validated by a pool
+ * of background threads, each thread uses its own filesystem instances.
+ * Otherwise one candidate is validated per call of Poll.
+ *
+ * Results of native candidates are stored together with their modification
+ * time in the configuration directory and reused while the time matches.
+ * Candidates that are gone are removed from the cache when a scan completes.
+ */
+class GameScanner {
+public:
+	enum class State {
+		/** Not validated yet */
+		Pending,
+		/** A game */
+		Game,
+		/** Not a game, can contain games */
+		Folder,
+		/** Cannot be opened */
+		Invalid
+	};
+
+	struct Entry {
+		std::string name;
+		/** Game title from RPG_RT.ini (UTF-8), can be empty */
+		std::string title;
+		State state = State::Pending;
+	};
+
+	/**
+	 * Starts validating the candidates.
+	 *
+	 * @param base directory containing the candidates
+	 * @param names names of the candidates in base
+	 */
+	GameScanner(FilesystemView base, std::vector<std::string> names);
+
+	GameScanner(const GameScanner&) = delete;
+	GameScanner& operator=(const GameScanner&) = delete;
+
+	/**
+	 * Cancels the background threads without waiting for them.
+	 * Validations in progress finish in the background and are discarded.
+	 */
+	~GameScanner();
+
+	/**
+	 * Collects the validated candidates, called every frame by the main thread.
+	 *
+	 * @return indices of the entries validated since the last call
+	 */
+	std::vector<int> Poll();
+
+	/** @return number of candidates */
+	int GetCount() const;
+
+	/**
+	 * @param index index of the candidate
+	 * @return candidate
+	 */
+	const Entry& GetEntry(int index) const;
+
+	/** @return true when all candidates are validated */
+	bool IsFinished() const;
+
+private:
+	struct Result {
+		int index = 0;
+		State state = State::Pending;
+		std::string title;
+		int64_t mtime = -1;
+		bool from_cache = false;
+	};
+
+	/** Data used by the background threads, kept alive by them after the scanner is destroyed */
+	struct Shared {
+		std::string base_path;
+		std::vector<std::string> names;
+		/** Modification time of the cached result of every candidate, -1 when not cached */
+		std::vector<int64_t> cached_mtimes;
+#ifdef HAVE_THREADS
+		std::mutex mutex;
+		std::vector<Result> results;
+		std::atomic<int> next_index { 0 };
+		std::atomic<bool> cancel { false };
+#endif
+	};
+
+	static Result Validate(const Shared& data, const FilesystemView& base, int index);
+	void Apply(Result result);
+	/** Removes the cache entries of candidates in the directory that were not scanned */
+	void RemoveStaleCacheEntries();
+
+	FilesystemView base_fs;
+	std::shared_ptr<Shared> shared;
+	std::vector<Entry> entries;
+	int resolved = 0;
+	int next_index = 0;
+
+#ifdef HAVE_THREADS
+	static void WorkerMain(std::shared_ptr<Shared> data);
+
+	bool use_workers = false;
+#endif
+};
+
+inline int GameScanner::GetCount() const {
+	return static_cast<int>(entries.size());
+}
+
+inline const GameScanner::Entry& GameScanner::GetEntry(int index) const {
+	return entries[index];
+}
+
+inline bool GameScanner::IsFinished() const {
+	return resolved == GetCount();
+}
+
+#endif
@@ -36,11 +36,18 @@
 #include "utils.h"
 #include "audio_secache.h"
 #include "feature.h"
+#include "game_clock.h"
 
 Game_System::Game_System()
 	: dbsys(&lcf::Data::system)
 { }
 
+Game_System::~Game_System() {
+	if (se_cache_hits > 0 || se_cache_misses > 0) {
+		Output::Debug("SE cache: {} hits, {} misses", se_cache_hits, se_cache_misses);
+	}
+}
+
 void Game_System::SetupFromSave(lcf::rpg::SaveSystem save) {
 	data = std::move(save);
 }
@@ -176,6 +183,19 @@ void Game_System::SePlay(const lcf::rpg::Sound& se, bool stop_sounds) {
 		tempo = Utils::Clamp<int32_t>(se.tempo, 10, 400);
 	}
 
+	// Fast path: The sound was played before and is still in the cache
+	auto se_cache = AudioSeCache::GetCachedSe(se.name);
+	if (se_cache) {
+		++se_cache_hits;
+		// Same as a new request: A pending request of this sound is cancelled
+		se_request_ids.erase(se.name);
+		if (!Game_Clock::IsUnlimitedSpeed()) {
+			Audio().SE_Play(std::move(se_cache), volume, tempo);
+		}
+		return;
+	}
+	++se_cache_misses;
+
 	FileRequestAsync* request = AsyncHandler::RequestFile("Sound", se.name);
 	lcf::rpg::Sound se_adj = se;
 	se_adj.volume = volume;
@@ -548,11 +568,18 @@ void Game_System::OnBgmReady(FileRequestResult* result) {
 	}
 
 	Audio().BGM_Play(std::move(stream), data.current_music.volume, data.current_music.tempo, data.current_music.fadein);
+	if (Game_Clock::IsUnlimitedSpeed()) {
+		// Music is resumed when fast forwarding ends
+		Audio().BGM_Pause();
+	}
 }
 
 void Game_System::OnBgmInelukiReady(FileRequestResult* result) {
 	bgm_pending = false;
 	Audio().BGM_Play(FileFinder::Game().OpenFile(result->file), data.current_music.volume, data.current_music.tempo, data.current_music.fadein);
+	if (Game_Clock::IsUnlimitedSpeed()) {
+		Audio().BGM_Pause();
+	}
 }
 
 void Game_System::OnSeReady(FileRequestResult* result, lcf::rpg::Sound se, bool stop_sounds) {
@@ -567,6 +594,11 @@ void Game_System::OnSeReady(FileRequestResult* result, lcf::rpg::Sound se, bool
 		return;
 	}
 
+	if (Game_Clock::IsUnlimitedSpeed()) {
+		// Sound is muted while fast forwarding without limit
+		return;
+	}
+
 	auto se_cache = AudioSeCache::GetCachedSe(result->file);
 	if (!se_cache) {
 		Filesystem_Stream::InputStream stream;
@@ -85,6 +85,8 @@ public:
 	 */
 	Game_System();
 
+	~Game_System();
+
 	/** Initialize from save game */
 	void SetupFromSave(lcf::rpg::SaveSystem save);
 
@@ -135,6 +137,12 @@ public:
 	 */
 	void SePlay(const lcf::rpg::Animation& animation);
 
+	/** @return number of sounds played directly from the sound effect cache */
+	int GetSeCacheHits() const;
+
+	/** @return number of sounds that were requested from the filesystem */
+	int GetSeCacheMisses() const;
+
 	/** @return system graphic filename.  */
 	StringView GetSystemName();
 
@@ -443,10 +451,20 @@ private:
 	FileRequestBinding music_request_id;
 	FileRequestBinding system_request_id;
 	std::map<std::string, FileRequestBinding> se_request_ids;
+	int se_cache_hits = 0;
+	int se_cache_misses = 0;
 	Color bg_color = Color{ 0, 0, 0, 255 };
 	bool bgm_pending = false;
 };
 
+inline int Game_System::GetSeCacheHits() const {
+	return se_cache_hits;
+}
+
+inline int Game_System::GetSeCacheMisses() const {
+	return se_cache_misses;
+}
+
 inline bool Game_System::HasSystemGraphic() {
 	return !GetSystemName().empty();
 }
@@ -30,6 +30,7 @@
 #include "drawable_mgr.h"
 #include "baseui.h"
 #include "game_clock.h"
+#include "parallel_renderer.h"
 
 using namespace std::chrono_literals;
 
@@ -40,6 +41,7 @@ namespace Graphics {
 
 	std::unique_ptr<MessageOverlay> message_overlay;
 	std::unique_ptr<FpsOverlay> fps_overlay;
+	std::unique_ptr<ParallelRenderer> renderer;
 
 	std::string window_title_key;
 }
@@ -53,6 +55,7 @@ void Graphics::Init() {
 }
 
 void Graphics::Quit() {
+	renderer.reset();
 	fps_overlay.reset();
 	message_overlay.reset();
 
@@ -125,7 +128,27 @@ void Graphics::LocalDraw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z)
 		current_scene->DrawBackground(dst);
 	}
 
-	drawable_list.Draw(dst, min_z, max_z);
+	drawable_list.Draw(dst, min_z, max_z, GetRenderer());
+}
+
+ParallelRenderer* Graphics::GetRenderer() {
+#ifdef HAVE_THREADS
+	const int threads = DisplayUi ? DisplayUi->GetRenderThreads() : 1;
+#else
+	const int threads = 1;
+#endif
+
+	if (threads <= 1) {
+		renderer.reset();
+		return nullptr;
+	}
+
+	if (!renderer || renderer->GetNumThreads() != threads) {
+		renderer = std::make_unique<ParallelRenderer>(threads);
+	}
+
+	// Nested drawing (e.g. a snapshot while drawing) is done sequentially
+	return renderer->IsActive() ? nullptr : renderer.get();
 }
 
 std::shared_ptr<Scene> Graphics::UpdateSceneCallback() {
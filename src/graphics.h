@@ -26,6 +26,7 @@
 #include "game_clock.h"
 
 class MessageOverlay;
+class ParallelRenderer;
 class Scene;
 
 /**
@@ -52,6 +53,14 @@ namespace Graphics {
 
 	void LocalDraw(Bitmap& dst, Drawable::Z_t min_z, Drawable::Z_t max_z);
 
+	/**
+	 * Returns the renderer used for drawing with multiple threads.
+	 * The renderer is (re)created according to the RenderThreads video option.
+	 *
+	 * @return renderer or nullptr when drawing sequentially
+	 */
+	ParallelRenderer* GetRenderer();
+
 	std::shared_ptr<Scene> UpdateSceneCallback();
 
 	/**
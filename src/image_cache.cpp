@@ -0,0 +1,141 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <cstring>
+#include <zlib.h>
+#include "image_cache.h"
+#include "filesystem_stream.h"
+#include "output.h"
+#include "pixel_format.h"
+#include "utils.h"
+
+namespace {
+	FilesystemView cache_fs;
+
+	constexpr char magic[4] = { 'E', 'P', 'I', 'C' };
+	// Increment when the format of the cached data changes
+	constexpr uint32_t version = 1;
+
+	uint64_t HashKey(StringView key) {
+		// FNV-1a
+		uint64_t hash = 14695981039346656037ull;
+		for (char c: key) {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	std::string MakeFilename(StringView key) {
+		// The checksum of the image is not part of the file name,
+		// a changed image replaces the entry of the old image
+		auto pos = key.rfind('|');
+		return fmt::format("{:016x}.bin", HashKey(key.substr(0, pos)));
+	}
+}
+
+void ImageCache::Init(FilesystemView fs) {
+	cache_fs = std::move(fs);
+}
+
+bool ImageCache::IsEnabled() {
+	return static_cast<bool>(cache_fs);
+}
+
+std::string ImageCache::MakeKey(StringView name, Span<const uint8_t> data, bool transparent, uint32_t flags, const DynamicFormat& format) {
+	const auto crc = crc32(crc32(0L, Z_NULL, 0), data.data(), static_cast<uInt>(data.size()));
+
+	return fmt::format("{}:{}:{:x}:{}/{}/{}/{}/{}/{}/{}/{}/{}/{}|{}:{:08x}",
+		name, transparent ? "T" : " ", flags,
+		format.bits, format.r.bits, format.r.shift, format.g.bits, format.g.shift,
+		format.b.bits, format.b.shift, format.a.bits, format.a.shift, static_cast<int>(format.alpha_type),
+		data.size(), crc);
+}
+
+std::vector<uint8_t> ImageCache::Read(StringView key) {
+	if (!cache_fs) {
+		return {};
+	}
+
+	auto filename = MakeFilename(key);
+	if (!cache_fs.Exists(filename)) {
+		return {};
+	}
+
+	auto is = cache_fs.OpenInputStream(filename);
+	if (!is) {
+		return {};
+	}
+
+	std::vector<uint8_t> data = Utils::ReadStream(is);
+
+	// Header: magic, version, key length, key
+	const size_t header_size = sizeof(magic) + sizeof(uint32_t) * 2;
+	if (data.size() < header_size || memcmp(data.data(), magic, sizeof(magic)) != 0) {
+		return {};
+	}
+
+	uint32_t file_version, key_size;
+	memcpy(&file_version, &data[sizeof(magic)], sizeof(file_version));
+	memcpy(&key_size, &data[sizeof(magic) + sizeof(file_version)], sizeof(key_size));
+
+	if (file_version != version || key_size != key.size() || data.size() < header_size + key_size ||
+			memcmp(&data[header_size], key.data(), key_size) != 0) {
+		// Outdated or hash collision
+		return {};
+	}
+
+	data.erase(data.begin(), data.begin() + header_size + key_size);
+	return data;
+}
+
+void ImageCache::Write(StringView key, Span<const uint8_t> data) {
+	if (!cache_fs) {
+		return;
+	}
+
+	auto filename = MakeFilename(key);
+
+	// Written to a temporary file first, an interrupted write keeps the old entry
+	const bool rename = cache_fs.IsFeatureSupported(Filesystem::Feature::Rename);
+	auto write_filename = rename ? filename + ".tmp" : filename;
+
+	auto os = cache_fs.OpenOutputStream(write_filename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+	if (!os) {
+		Output::Debug("ImageCache: Cannot write {}", filename);
+		return;
+	}
+
+	const uint32_t key_size = static_cast<uint32_t>(key.size());
+	os.write(magic, sizeof(magic));
+	os.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	os.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+	os.write(key.data(), key.size());
+	os.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+	const bool success = static_cast<bool>(os);
+	os.Close();
+
+	if (rename) {
+		if (!success || !cache_fs.RenameFile(write_filename, filename)) {
+			Output::Debug("ImageCache: Cannot write {}", filename);
+			cache_fs.RemoveFile(write_filename);
+		}
+		cache_fs.ClearCache();
+	}
+}
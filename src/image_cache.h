@@ -0,0 +1,81 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_IMAGE_CACHE_H
+#define EP_IMAGE_CACHE_H
+
+// Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "filesystem.h"
+#include "span.h"
+#include "string_view.h"
+
+class DynamicFormat;
+
+/**
+ * Persistent cache of decoded images.
+ *
+ * Stores images after decoding, premultiplication and conversion into the
+ * screen format, so later sessions can copy the pixels instead of decoding
+ * the image file again. Entries are keyed by the image path, the size and a
+ * checksum of the encoded data, the target format and the load flags.
+ * There is one entry per image path, format and flags: When the image file
+ * changes its entry is replaced.
+ */
+namespace ImageCache {
+	/**
+	 * Enables the cache.
+	 *
+	 * @param fs directory the cache files are stored in, an invalid view disables the cache
+	 */
+	void Init(FilesystemView fs);
+
+	/** @return whether the cache is enabled */
+	bool IsEnabled();
+
+	/**
+	 * Builds the cache key of an encoded image.
+	 *
+	 * @param name path of the image
+	 * @param data encoded image data
+	 * @param transparent whether the image is loaded with transparency
+	 * @param flags Bitmap load flags
+	 * @param format target pixel format
+	 * @return cache key
+	 */
+	std::string MakeKey(StringView name, Span<const uint8_t> data, bool transparent, uint32_t flags, const DynamicFormat& format);
+
+	/**
+	 * Reads a cache entry.
+	 *
+	 * @param key cache key
+	 * @return cached data, empty when the key is not cached
+	 */
+	std::vector<uint8_t> Read(StringView key);
+
+	/**
+	 * Writes a cache entry, replacing an older entry with the same key.
+	 *
+	 * @param key cache key
+	 * @param data data to cache
+	 */
+	void Write(StringView key, Span<const uint8_t> data);
+}
+
+#endif
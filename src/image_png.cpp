@@ -146,6 +146,19 @@ static void ReadPalettedData(
 	int num_palette;
 	png_get_PLTE(png_ptr, info_ptr, &palette, &num_palette);
 
+	// RGBA value of every palette index, out of range indices are black
+	uint32_t lookup[256] = {};
+	for (int i = 0; i < num_palette && i < 256; i++) {
+		png_color& color = palette[i];
+		uint8_t alpha = (i == 0 && transparent) ? 0 : 255;
+		uint8_t rgba[4] = { color.red, color.green, color.blue, alpha };
+		memcpy(&lookup[i], rgba, sizeof(rgba));
+	}
+	for (int i = num_palette; i < 256; i++) {
+		uint8_t rgba[4] = { 0, 0, 0, 255 };
+		memcpy(&lookup[i], rgba, sizeof(rgba));
+	}
+
 	for (png_uint_32 y = 0; y < h; y++) {
 		// We read the indices (w bytes) into the end of the pixel
 		// data for this row (4w bytes), then scan over them
@@ -159,12 +172,8 @@ static void ReadPalettedData(
 		png_read_row(png_ptr, (png_bytep)indices, NULL);
 
 		uint32_t* dst = beginning_of_row;
-		for (png_uint_32 x = 0; x < w; x++, dst++) {
-			uint8_t idx = indices[x];
-			png_color& color = palette[idx];
-			uint8_t alpha = (idx == 0 && transparent) ? 0 : 255;
-			uint8_t rgba[4] = { color.red, color.green, color.blue, alpha };
-			*dst = *(uint32_t*)rgba;
+		for (png_uint_32 x = 0; x < w; x++) {
+			dst[x] = lookup[indices[x]];
 		}
 	}
 }
@@ -181,21 +190,23 @@ static void ReadGrayData(
 	png_set_filler(png_ptr, 0xFF, PNG_FILLER_AFTER);
 	png_read_update_info(png_ptr, info_ptr);
 
+	uint8_t ck1[4] = {0, 0, 0, 255};
+	uint8_t ck2[4] = {0, 0, 0,   0};
+	uint32_t srckey, dstkey;
+	memcpy(&srckey, ck1, sizeof(ck1));
+	memcpy(&dstkey, ck2, sizeof(ck2));
+
 	for (png_uint_32 y = 0; y < h; y++) {
 		png_bytep dst = (png_bytep) pixels + y * w * 4;
 		png_read_row(png_ptr, dst, NULL);
-	}
 
-	// Black pixels are transparent
-	if (transparent) {
-		uint8_t ck1[4] = {0, 0, 0, 255};
-		uint8_t ck2[4] = {0, 0, 0,   0};
-		uint32_t srckey = *(uint32_t*)ck1;
-		uint32_t dstkey = *(uint32_t*)ck2;
-		uint32_t* p = (uint32_t*) pixels;
-		for (unsigned i = 0; i < w * h; i++, p++)
-			if (*p == srckey)
-				*p = dstkey;
+		// Black pixels are transparent, replaced while the row is in the cache
+		if (transparent) {
+			uint32_t* p = (uint32_t*) dst;
+			for (png_uint_32 x = 0; x < w; x++) {
+				p[x] = (p[x] == srckey) ? dstkey : p[x];
+			}
+		}
 	}
 }
 
@@ -53,17 +53,18 @@ bool ImageXYZ::ReadXYZ(const uint8_t* data, unsigned len, bool transparent,
 		return false;
 	}
 
-	uint8_t* dst = (uint8_t*) pixels;
+	// RGBA value of every palette index
+	uint32_t lookup[256];
+	for (int i = 0; i < 256; i++) {
+		const uint8_t* color = palette[i];
+		uint8_t rgba[4] = { color[0], color[1], color[2], (uint8_t)((transparent && i == 0) ? 0 : 255) };
+		memcpy(&lookup[i], rgba, sizeof(rgba));
+	}
+
+	uint32_t* dst = (uint32_t*) pixels;
 	const uint8_t* src = (const uint8_t*) &dst_buffer[768];
-	for (int y = 0; y < h; y++) {
-		for (int x = 0; x < w; x++) {
-			uint8_t pix = *src++;
-			const uint8_t* color = palette[pix];
-			*dst++ = color[0];
-			*dst++ = color[1];
-			*dst++ = color[2];
-			*dst++ = (transparent && pix == 0) ? 0 : 255;
-		}
+	for (int i = 0; i < w * h; i++) {
+		dst[i] = lookup[src[i]];
 	}
 
 	width = w;
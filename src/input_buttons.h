@@ -85,6 +85,7 @@ namespace Input {
 		FAST_FORWARD_PLUS,
 		TOGGLE_FULLSCREEN,
 		TOGGLE_ZOOM,
+		SAVE_TRACE,
 		BUTTON_COUNT
 	};
 
@@ -131,6 +132,7 @@ namespace Input {
 		"FAST_FORWARD_PLUS",
 		"TOGGLE_FULLSCREEN",
 		"TOGGLE_ZOOM",
+		"SAVE_TRACE",
 		"BUTTON_COUNT");
 
 	constexpr auto kButtonHelp = lcf::makeEnumTags<InputButton>(
@@ -178,6 +180,7 @@ namespace Input {
 		"Tua nhanh trò chơi hơn nữa (x10)",
 		"Bật chế độ toàn màn hình",
 		"Chuyển đổi mức thu phóng cửa sổ",
+		"Lưu dữ liệu đo hiệu năng (trace)",
 		"Tổng số nút");
 
 	/**
@@ -191,6 +194,7 @@ namespace Input {
 			case TAKE_SCREENSHOT:
 			case SHOW_LOG:
 			case TOGGLE_ZOOM:
+			case SAVE_TRACE:
 			case FAST_FORWARD:
 			case FAST_FORWARD_PLUS:
 				return true;
@@ -96,6 +96,9 @@ Input::ButtonMappingArray Input::GetDefaultButtonMappings() {
 		{SHOW_LOG, Keys::F3},
 		{TOGGLE_FULLSCREEN, Keys::F4},
 		{TOGGLE_ZOOM, Keys::F5},
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+		{SAVE_TRACE, Keys::F8},
+#endif
 		{PAGE_UP, Keys::PGUP},
 		{PAGE_DOWN, Keys::PGDN},
 		{RESET, Keys::F12},
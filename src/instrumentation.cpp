@@ -18,10 +18,76 @@
 #include "instrumentation.h"
 #include "utils.h"
 
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+#include "filefinder.h"
+#include "game_clock.h"
+#include "output.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <fmt/core.h>
+#endif
+
 #ifdef PLAYER_INSTRUMENTATION_VTUNE
 __itt_domain* Instrumentation::domain = nullptr;
 #endif
 
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+int64_t Instrumentation::frame_begin = 0;
+
+namespace {
+	struct TraceEvent {
+		const char* name;
+		int64_t begin;
+		int64_t end;
+	};
+
+	/**
+	 * Fixed size block of events.
+	 * Only the owning thread appends, the size is published with release
+	 * semantics so that SaveTrace can read all events below it without locking.
+	 */
+	struct TraceChunk {
+		static constexpr size_t capacity = 4096;
+
+		std::array<TraceEvent, capacity> events;
+		std::atomic<size_t> size = { 0 };
+		std::atomic<TraceChunk*> next = { nullptr };
+		std::unique_ptr<TraceChunk> next_owner;
+	};
+
+	struct TraceBuffer {
+		/** Limits the memory usage to ~24 MB per thread */
+		static constexpr size_t max_chunks = 256;
+
+		int tid = 0;
+		TraceChunk head;
+		TraceChunk* tail = &head;
+		size_t num_chunks = 1;
+		std::atomic<size_t> dropped = { 0 };
+	};
+
+	Game_Clock::time_point trace_start;
+	std::mutex buffers_mutex;
+	std::vector<std::shared_ptr<TraceBuffer>> buffers;
+	thread_local std::shared_ptr<TraceBuffer> thread_buffer;
+
+	TraceBuffer& GetThreadBuffer() {
+		if (!thread_buffer) {
+			// Only taken once per thread
+			std::lock_guard<std::mutex> lock(buffers_mutex);
+			thread_buffer = std::make_shared<TraceBuffer>();
+			thread_buffer->tid = static_cast<int>(buffers.size()) + 1;
+			buffers.push_back(thread_buffer);
+		}
+		return *thread_buffer;
+	}
+}
+#endif
+
 void Instrumentation::Init(const char* name) {
 #ifdef PLAYER_INSTRUMENTATION_VTUNE
 	assert(!domain);
@@ -33,4 +99,104 @@ void Instrumentation::Init(const char* name) {
 #else
 	(void)name;
 #endif
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	trace_start = Game_Clock::now();
+	// Register the main thread first
+	GetThreadBuffer();
+#endif
+}
+
+void Instrumentation::Quit() {
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	SaveTrace();
+#endif
+}
+
+#ifndef PLAYER_INSTRUMENTATION_TRACE
+bool Instrumentation::SaveTrace() {
+	return false;
+}
+#else
+int64_t Instrumentation::TraceNow() noexcept {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Game_Clock::now() - trace_start).count();
 }
+
+void Instrumentation::TraceZone(const char* name, int64_t begin, int64_t end) noexcept {
+	TraceBuffer* thread_buf;
+	try {
+		thread_buf = &GetThreadBuffer();
+	} catch (const std::exception&) {
+		// The thread has no buffer to count the event as dropped
+		return;
+	}
+	auto& buf = *thread_buf;
+	auto* chunk = buf.tail;
+
+	size_t size = chunk->size.load(std::memory_order_relaxed);
+	if (size == TraceChunk::capacity) {
+		if (buf.num_chunks == TraceBuffer::max_chunks) {
+			buf.dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		chunk->next_owner.reset(new (std::nothrow) TraceChunk());
+		if (!chunk->next_owner) {
+			buf.dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		chunk->next.store(chunk->next_owner.get(), std::memory_order_release);
+		chunk = chunk->next_owner.get();
+		buf.tail = chunk;
+		++buf.num_chunks;
+		size = 0;
+	}
+
+	chunk->events[size] = { name, begin, end };
+	chunk->size.store(size + 1, std::memory_order_release);
+}
+
+bool Instrumentation::SaveTrace() {
+	int index = 0;
+	std::string file;
+	do {
+		file = "trace_" + std::to_string(index++) + ".json";
+	} while (FileFinder::Save().Exists(file));
+
+	auto os = FileFinder::Save().OpenOutputStream(file, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc);
+	if (!os) {
+		Output::Warning("Instrumentation: Không thể ghi {}", file);
+		return false;
+	}
+
+	std::vector<std::shared_ptr<TraceBuffer>> snapshot;
+	{
+		std::lock_guard<std::mutex> lock(buffers_mutex);
+		snapshot = buffers;
+	}
+
+	os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"EasyRPG Player\"}}";
+
+	size_t num_events = 0;
+	size_t num_dropped = 0;
+	for (auto& buf: snapshot) {
+		os << fmt::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+				buf->tid, buf->tid == 1 ? "Main" : "Thread " + std::to_string(buf->tid));
+
+		for (auto* chunk = &buf->head; chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+			const size_t size = chunk->size.load(std::memory_order_acquire);
+			for (size_t i = 0; i < size; ++i) {
+				const auto& ev = chunk->events[i];
+				os << fmt::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+						ev.name, buf->tid, ev.begin / 1000.0, (ev.end - ev.begin) / 1000.0);
+			}
+			num_events += size;
+		}
+		num_dropped += buf->dropped.load(std::memory_order_relaxed);
+	}
+
+	os << "\n]}\n";
+
+	Output::Debug("Instrumentation: Đã lưu {} ({} sự kiện, {} bị bỏ qua)", file, num_events, num_dropped);
+	return true;
+}
+#endif
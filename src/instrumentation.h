@@ -18,14 +18,11 @@
 #ifndef EP_INSTRUMENTATION_H
 #define EP_INSTRUMENTATION_H
 
-#if defined(PLAYER_INSTRUMENTATION) && PLAYER_INSTRUMENTATION == VTune
-#define PLAYER_INSTRUMENTATION_VTUNE
-#endif
-
 #ifdef PLAYER_INSTRUMENTATION_VTUNE
 #include <ittnotify.h>
 #endif
 #include <cassert>
+#include <cstdint>
 
 class Instrumentation {
 public:
@@ -36,6 +33,22 @@ public:
 	 */
 	static void Init(const char* name);
 
+	/**
+	 * Must be called once on shutdown.
+	 * When the Trace backend is used the recorded trace is written to disk.
+	 */
+	static void Quit();
+
+	/**
+	 * Writes all zones recorded so far as a Chrome trace (JSON) file into
+	 * the save directory. The file can be opened in chrome://tracing or
+	 * in the Perfetto UI.
+	 * Only supported by the Trace backend.
+	 *
+	 * @return true when the trace was written
+	 */
+	static bool SaveTrace();
+
 	/** Call at the beginning of a frame */
 	static void FrameBegin();
 
@@ -73,10 +86,44 @@ public:
 		bool begun = false;
 	};
 
+	/**
+	 * RAII wrapper around a named zone.
+	 * The zone covers the lifetime of the object.
+	 * Zones can be nested and used from any thread.
+	 */
+	class ZoneScope {
+	public:
+		/**
+		 * Create a ZoneScope
+		 *
+		 * @param name name of the zone, must be a string literal
+		 */
+		explicit ZoneScope(const char* name) noexcept;
+
+		ZoneScope(const ZoneScope&) = delete;
+		ZoneScope& operator=(const ZoneScope&) = delete;
+
+		/** Ends the zone */
+		~ZoneScope();
+	private:
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+		const char* name;
+		int64_t begin;
+#endif
+	};
+
 private:
 #ifdef PLAYER_INSTRUMENTATION_VTUNE
 	static __itt_domain* domain;
 #endif
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	/** @return current time in nanoseconds since Init() */
+	static int64_t TraceNow() noexcept;
+	/** Appends a zone to the buffer of the calling thread, counted as dropped when out of memory */
+	static void TraceZone(const char* name, int64_t begin, int64_t end) noexcept;
+
+	static int64_t frame_begin;
+#endif
 };
 
 inline void Instrumentation::FrameBegin() {
@@ -84,12 +131,18 @@ inline void Instrumentation::FrameBegin() {
 	assert(domain);
 	__itt_frame_begin_v3(domain, nullptr);
 #endif
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	frame_begin = TraceNow();
+#endif
 }
 inline void Instrumentation::FrameEnd() {
 #ifdef PLAYER_INSTRUMENTATION_VTUNE
 	assert(domain);
 	__itt_frame_end_v3(domain, nullptr);
 #endif
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	TraceZone("Frame", frame_begin, TraceNow());
+#endif
 }
 
 inline Instrumentation::FrameScope::FrameScope(bool frame_begin)
@@ -137,4 +190,30 @@ inline void Instrumentation::FrameScope::Dismiss() noexcept {
 	begun = false;
 }
 
+inline Instrumentation::ZoneScope::ZoneScope(const char* name) noexcept
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	: name(name), begin(TraceNow())
+#endif
+{
+#ifdef PLAYER_INSTRUMENTATION_VTUNE
+	assert(domain);
+#ifdef _WIN32
+	__itt_task_begin(domain, __itt_null, __itt_null, __itt_string_handle_createA(name));
+#else
+	__itt_task_begin(domain, __itt_null, __itt_null, __itt_string_handle_create(name));
+#endif
+#elif !defined(PLAYER_INSTRUMENTATION_TRACE)
+	(void)name;
+#endif
+}
+
+inline Instrumentation::ZoneScope::~ZoneScope() {
+#ifdef PLAYER_INSTRUMENTATION_VTUNE
+	__itt_task_end(domain);
+#endif
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+	TraceZone(name, begin, TraceNow());
+#endif
+}
+
 #endif
@@ -16,6 +16,7 @@
  */
 
 // Headers
+#include "system.h"
 #include <cstdlib>
 #include <cstdarg>
 #include <ctime>
@@ -24,6 +25,13 @@
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#ifdef HAVE_THREADS
+#  include <condition_variable>
+#  include <mutex>
+#endif
 #ifdef __ANDROID__
 #  include <android/log.h>
 #elif defined(EMSCRIPTEN)
@@ -86,12 +94,44 @@ namespace {
 	bool ignore_pause = false;
 
 	std::vector<std::string> log_buffer;
+#ifdef HAVE_THREADS
+	// Background threads (e.g. the game browser scanner) log too
+	std::mutex log_mutex;
+	const std::thread::id main_thread_id = std::this_thread::get_id();
+
+	// Messages are written to the log file and the terminal by a background thread
+	struct LogEntry {
+		LogLevel lvl;
+		std::string msg;
+	};
+	constexpr size_t max_queued_messages = 4096;
+	std::mutex queue_mutex;
+	std::condition_variable queue_cv;
+	std::vector<LogEntry> log_queue;
+	std::thread log_thread;
+	bool log_thread_quit = false;
+#endif
 	// pair of repeat count + message
 	struct {
 		int repeat = 0;
 		std::string msg;
 		LogLevel lvl = {};
 	} last_message;
+
+	// Rate limit per callsite: A burst of messages, then a few per second
+	constexpr double rate_limit_burst = 100.0;
+	constexpr double rate_limit_per_second = 10.0;
+	constexpr size_t max_callsites = 1024;
+	struct Callsite {
+		double tokens = rate_limit_burst;
+		std::chrono::steady_clock::time_point last_time;
+		int dropped = 0;
+	};
+#ifdef HAVE_THREADS
+	std::mutex callsite_mutex;
+#endif
+	std::unordered_map<const char*, Callsite> callsites;
+	std::atomic<int> dropped_messages { 0 };
 }
 
 LogLevel Output::GetLogLevel() {
@@ -110,7 +150,11 @@ void Output::IgnorePause(bool const val) {
 	ignore_pause = val;
 }
 
-static void WriteLog(LogLevel lvl, std::string const& msg, Color const& c = Color()) {
+static void WriteSinks(LogLevel lvl, std::string const& msg) {
+#ifdef HAVE_THREADS
+	std::lock_guard<std::mutex> lock(log_mutex);
+#endif
+
 #ifdef EMSCRIPTEN
 
 // Allow pretty log output and filtering in browser console
@@ -200,6 +244,93 @@ EM_ASM({
 	}
 #  endif
 
+#endif
+}
+
+#ifdef HAVE_THREADS
+static void LogThreadMain() {
+	std::vector<LogEntry> entries;
+
+	std::unique_lock<std::mutex> lock(queue_mutex);
+	while (true) {
+		queue_cv.wait(lock, [] { return !log_queue.empty() || log_thread_quit; });
+		if (log_queue.empty()) {
+			// Quit requested and everything written
+			break;
+		}
+
+		entries.swap(log_queue);
+		lock.unlock();
+
+		for (auto& entry: entries) {
+			WriteSinks(entry.lvl, entry.msg);
+		}
+		entries.clear();
+
+		lock.lock();
+	}
+}
+
+/** Writes the queued messages and stops the log thread, later messages are written directly */
+static void StopLogThread() {
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex);
+		log_thread_quit = true;
+	}
+	queue_cv.notify_one();
+
+	if (log_thread.joinable()) {
+		log_thread.join();
+	}
+}
+
+/**
+ * Queues a message for the log thread.
+ *
+ * @return false when the log thread was stopped
+ */
+static bool QueueLog(LogLevel lvl, std::string const& msg) {
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex);
+		if (log_thread_quit) {
+			return false;
+		}
+
+		if (!log_thread.joinable()) {
+			log_thread = std::thread(LogThreadMain);
+			// Do not destroy a running thread when the Player exits without Output::Quit
+			std::atexit(StopLogThread);
+		}
+
+		if (log_queue.size() >= max_queued_messages) {
+			++dropped_messages;
+			return true;
+		}
+
+		log_queue.push_back({ lvl, msg });
+	}
+	queue_cv.notify_one();
+
+	return true;
+}
+#endif
+
+static void WriteLog(LogLevel lvl, std::string const& msg, Color const& c = Color()) {
+#ifdef HAVE_THREADS
+	if (lvl == LogLevel::Error) {
+		// The Player exits after an error, nothing may get lost
+		StopLogThread();
+		WriteSinks(lvl, msg);
+	} else if (!QueueLog(lvl, msg)) {
+		WriteSinks(lvl, msg);
+	}
+
+	// The overlay is only accessed by the main thread
+	if (std::this_thread::get_id() != main_thread_id) {
+		return;
+	}
+#else
+	WriteSinks(lvl, msg);
 #endif
 
 	if (lvl != LogLevel::Debug && lvl != LogLevel::Error) {
@@ -237,7 +368,59 @@ static void HandleErrorOutput(const std::string& err) {
 	}
 }
 
+bool Output::CheckRateLimit(const char* callsite) {
+	const auto now = std::chrono::steady_clock::now();
+	int dropped = 0;
+
+	{
+#ifdef HAVE_THREADS
+		std::lock_guard<std::mutex> lock(callsite_mutex);
+#endif
+		auto it = callsites.find(callsite);
+		if (it == callsites.end()) {
+			if (callsites.size() >= max_callsites) {
+				// Probably not a literal, do not grow without bounds
+				return true;
+			}
+			it = callsites.emplace(callsite, Callsite()).first;
+			it->second.last_time = now;
+		}
+
+		auto& site = it->second;
+		const double elapsed = std::chrono::duration<double>(now - site.last_time).count();
+		site.tokens = std::min(rate_limit_burst, site.tokens + elapsed * rate_limit_per_second);
+		site.last_time = now;
+
+		if (site.tokens < 1.0) {
+			++site.dropped;
+			++dropped_messages;
+			return false;
+		}
+
+		site.tokens -= 1.0;
+		std::swap(dropped, site.dropped);
+	}
+
+	if (dropped > 0 && log_level >= LogLevel::Debug) {
+		DebugStr(fmt::format("Skipped {} messages: {}", dropped, callsite));
+	}
+
+	return true;
+}
+
+int Output::GetDroppedMessages() {
+	return dropped_messages;
+}
+
 void Output::Quit() {
+	if (dropped_messages > 0) {
+		DebugStr(fmt::format("{} log messages were dropped", dropped_messages.load()));
+	}
+
+#ifdef HAVE_THREADS
+	StopLogThread();
+#endif
+
 	if (LOG_FILE) {
 		LOG_FILE.Close();
 	}
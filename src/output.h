@@ -62,10 +62,27 @@ namespace Output {
 	void SetTermColor(bool colored);
 
 	/**
-	 * Closes the log file handle and trims the file.
+	 * Writes the queued log messages, closes the log file handle and trims the file.
 	 */
 	void Quit();
 
+	/**
+	 * Rate limit of a log callsite, checked before the message is formatted.
+	 * A callsite may log a burst of messages, afterwards the messages are
+	 * limited to a few per second and the others are dropped.
+	 *
+	 * @param callsite format string literal, identifies the callsite
+	 * @return true when the message shall be logged
+	 */
+	bool CheckRateLimit(const char* callsite);
+
+	/** Messages with a non-literal format string are not rate limited */
+	template <typename T>
+	bool CheckRateLimit(const T&) { return true; }
+
+	/** @return number of messages dropped by the rate limit or because the log queue was full */
+	int GetDroppedMessages();
+
 	/**
 	 * Takes screenshot and save it in the save directory.
 	 *
@@ -170,6 +187,9 @@ namespace Output {
 
 template <typename FmtStr, typename... Args>
 inline void Output::Info(FmtStr&& fmtstr, Args&&... args) {
+	if (GetLogLevel() < LogLevel::Info || !CheckRateLimit(fmtstr)) {
+		return;
+	}
 	InfoStr(fmt::format(std::forward<FmtStr>(fmtstr), std::forward<Args>(args)...));
 }
 
@@ -180,11 +200,17 @@ inline void Output::Error(FmtStr&& fmtstr, Args&&... args) {
 
 template <typename FmtStr, typename... Args>
 inline void Output::Warning(FmtStr&& fmtstr, Args&&... args) {
+	if (GetLogLevel() < LogLevel::Warning || !CheckRateLimit(fmtstr)) {
+		return;
+	}
 	WarningStr(fmt::format(std::forward<FmtStr>(fmtstr), std::forward<Args>(args)...));
 }
 
 template <typename FmtStr, typename... Args>
 inline void Output::Debug(FmtStr&& fmtstr, Args&&... args) {
+	if (GetLogLevel() < LogLevel::Debug || !CheckRateLimit(fmtstr)) {
+		return;
+	}
 	DebugStr(fmt::format(std::forward<FmtStr>(fmtstr), std::forward<Args>(args)...));
 }
 
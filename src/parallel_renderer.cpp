@@ -0,0 +1,204 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "parallel_renderer.h"
+#include "bitmap.h"
+#include "instrumentation.h"
+#include <algorithm>
+#include <cassert>
+
+ParallelRenderer::ParallelRenderer(int num_threads) {
+#ifdef HAVE_THREADS
+	this->num_threads = std::max(num_threads, 1);
+
+	// Band 0 is rendered by the calling thread
+	for (int i = 1; i < this->num_threads; ++i) {
+		workers.emplace_back(&ParallelRenderer::WorkerMain, this, i);
+	}
+#else
+	(void)num_threads;
+#endif
+}
+
+ParallelRenderer::~ParallelRenderer() {
+	if (target) {
+		End();
+	}
+
+#ifdef HAVE_THREADS
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+	}
+	work_cv.notify_all();
+
+	for (auto& worker: workers) {
+		worker.join();
+	}
+#endif
+}
+
+void ParallelRenderer::Begin(Bitmap& dst) {
+	assert(!target);
+	assert(!dst.recorder);
+
+	target = &dst;
+	CreateBands();
+	dst.recorder = this;
+}
+
+void ParallelRenderer::End() {
+	assert(target);
+
+	Flush();
+	target->recorder = nullptr;
+	target = nullptr;
+}
+
+void ParallelRenderer::Record(Command cmd) {
+	commands.push_back(std::move(cmd));
+}
+
+void ParallelRenderer::Record(Command cmd, const Bitmap& src) {
+	AddSource(src);
+	commands.push_back(std::move(cmd));
+}
+
+void ParallelRenderer::Record(Command cmd, const Bitmap& src, const Bitmap& src2) {
+	AddSource(src);
+	AddSource(src2);
+	commands.push_back(std::move(cmd));
+}
+
+void ParallelRenderer::AddSource(const Bitmap& src) {
+	assert(src.pending_reader == nullptr || src.pending_reader == this);
+
+	if (!src.pending_reader) {
+		src.pending_reader = this;
+		sources.push_back(&src);
+	}
+}
+
+void ParallelRenderer::Flush() {
+	if (commands.empty()) {
+		return;
+	}
+
+	Instrumentation::ZoneScope zone("ParallelRenderer::Flush");
+
+#ifdef HAVE_THREADS
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = static_cast<int>(workers.size());
+		++generation;
+	}
+	work_cv.notify_all();
+
+	RenderBand(0);
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		done_cv.wait(lock, [this]() { return pending == 0; });
+	}
+#else
+	RenderBand(0);
+#endif
+
+	commands.clear();
+
+	for (auto* src: sources) {
+		src->pending_reader = nullptr;
+	}
+	sources.clear();
+}
+
+void ParallelRenderer::CreateBands() {
+	const int width = target->width();
+	const int height = target->height();
+	const int band_height = (height + num_threads - 1) / num_threads;
+
+	if (!bands.empty()) {
+		auto& band = *bands.front();
+		if (band.pixels() == target->pixels() && band.width() == width && band.height() == height && band.pitch() == target->pitch()) {
+			return;
+		}
+	}
+
+	// Every band is a view of the whole target, clipped to its rows,
+	// so the commands can use the coordinates of the target.
+	bands.clear();
+	for (int i = 0; i < num_threads; ++i) {
+		auto band = Bitmap::Create(target->pixels(), width, height, target->pitch(), target->format);
+		band->SetClipRect(Rect(0, i * band_height, width, std::max(std::min(band_height, height - i * band_height), 0)));
+		bands.push_back(std::move(band));
+	}
+}
+
+void ParallelRenderer::RenderBand(int band) {
+	auto& dst = *bands[band];
+	if (dst.GetClipRect().IsEmpty()) {
+		return;
+	}
+
+	for (auto& cmd: commands) {
+		cmd(dst);
+	}
+}
+
+#ifdef HAVE_THREADS
+void ParallelRenderer::WorkerMain(int band) {
+	unsigned seen = 0;
+
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			work_cv.wait(lock, [&]() { return quit || generation != seen; });
+			if (quit) {
+				return;
+			}
+			seen = generation;
+		}
+
+		RenderBand(band);
+
+		bool done;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			done = (--pending == 0);
+		}
+		if (done) {
+			done_cv.notify_one();
+		}
+	}
+}
+#endif
+
+ParallelRenderer::Barrier::Barrier(Bitmap& bitmap)
+	: bitmap(bitmap), recorder(bitmap.recorder)
+{
+	bitmap.FlushPendingReads();
+
+	if (recorder) {
+		recorder->Flush();
+		bitmap.recorder = nullptr;
+	}
+}
+
+ParallelRenderer::Barrier::~Barrier() {
+	bitmap.recorder = recorder;
+}
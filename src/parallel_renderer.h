@@ -0,0 +1,161 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_PARALLEL_RENDERER_H
+#define EP_PARALLEL_RENDERER_H
+
+// Headers
+#include "system.h"
+#include <functional>
+#include <memory>
+#include <vector>
+#ifdef HAVE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+#include "memory_management.h"
+
+class Bitmap;
+
+/**
+ * Renders into a bitmap with multiple threads.
+ *
+ * While recording, drawing operations on the target bitmap are not executed
+ * but stored as commands. On Flush the target is split into horizontal bands
+ * and every band replays all commands in recording order, clipped to the band.
+ * The bands are rendered concurrently by a pool of worker threads, so the
+ * result is identical to drawing sequentially.
+ *
+ * Operations that cannot be clipped (direct pixel access) or that read from
+ * the target are executed as a barrier: all pending commands are flushed first
+ * and the operation then runs immediately on the calling thread.
+ *
+ * The source bitmaps of the recorded commands are tracked: modifying or
+ * destroying one of them flushes the pending commands first.
+ */
+class ParallelRenderer {
+public:
+	using Command = std::function<void(Bitmap&)>;
+
+	/**
+	 * Creates the renderer and starts the worker threads.
+	 *
+	 * @param num_threads number of bands rendered concurrently, including the calling thread
+	 */
+	explicit ParallelRenderer(int num_threads);
+
+	ParallelRenderer(const ParallelRenderer&) = delete;
+	ParallelRenderer& operator=(const ParallelRenderer&) = delete;
+
+	/** Stops the worker threads */
+	~ParallelRenderer();
+
+	/** @return number of bands rendered concurrently */
+	int GetNumThreads() const;
+
+	/** @return true while recording */
+	bool IsActive() const;
+
+	/**
+	 * Starts recording the drawing operations on dst.
+	 *
+	 * @param dst target bitmap
+	 */
+	void Begin(Bitmap& dst);
+
+	/** Renders all recorded commands and stops recording */
+	void End();
+
+	/** Renders all recorded commands */
+	void Flush();
+
+	/**
+	 * Appends a command.
+	 *
+	 * @param cmd drawing operation, invoked once per band
+	 */
+	void Record(Command cmd);
+
+	/**
+	 * Appends a command reading from another bitmap.
+	 *
+	 * @param cmd drawing operation, invoked once per band
+	 * @param src bitmap read by the command
+	 */
+	void Record(Command cmd, const Bitmap& src);
+
+	/**
+	 * Appends a command reading from two other bitmaps.
+	 *
+	 * @param cmd drawing operation, invoked once per band
+	 * @param src bitmap read by the command
+	 * @param src2 second bitmap read by the command
+	 */
+	void Record(Command cmd, const Bitmap& src, const Bitmap& src2);
+
+	/**
+	 * RAII helper for operations that cannot be recorded.
+	 * Flushes the recorder of the bitmap and the commands reading from it
+	 * and suspends recording until destroyed.
+	 */
+	class Barrier {
+	public:
+		explicit Barrier(Bitmap& bitmap);
+		Barrier(const Barrier&) = delete;
+		Barrier& operator=(const Barrier&) = delete;
+		~Barrier();
+	private:
+		Bitmap& bitmap;
+		ParallelRenderer* recorder;
+	};
+
+private:
+	void CreateBands();
+	void RenderBand(int band);
+	void AddSource(const Bitmap& src);
+#ifdef HAVE_THREADS
+	void WorkerMain(int band);
+#endif
+
+	int num_threads = 1;
+	Bitmap* target = nullptr;
+	std::vector<Command> commands;
+	/** Bitmaps read by the pending commands */
+	std::vector<const Bitmap*> sources;
+	std::vector<BitmapRef> bands;
+
+#ifdef HAVE_THREADS
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable work_cv;
+	std::condition_variable done_cv;
+	unsigned generation = 0;
+	int pending = 0;
+	bool quit = false;
+#endif
+};
+
+inline int ParallelRenderer::GetNumThreads() const {
+	return num_threads;
+}
+
+inline bool ParallelRenderer::IsActive() const {
+	return target != nullptr;
+}
+
+#endif
@@ -23,28 +23,87 @@
 #include "game_map.h"
 #include "drawable_mgr.h"
 #include "game_screen.h"
+#include <algorithm>
 
 Plane::Plane() : Drawable(0)
 {
 	DrawableMgr::Register(this);
 }
 
-void Plane::Draw(Bitmap& dst) {
-	if (!bitmap) return;
+namespace {
+	/**
+	 * Marks the blocks covered by a range of a repeated image.
+	 *
+	 * @param blocks flag per block, set for covered blocks
+	 * @param start start of the range, wraps around
+	 * @param length length of the range
+	 * @param size image size
+	 */
+	void MarkBlocks(std::vector<bool>& blocks, int start, int length, int size) {
+		if (length >= size) {
+			std::fill(blocks.begin(), blocks.end(), true);
+			return;
+		}
+
+		start = ((start % size) + size) % size;
+		const int end = start + length;
+
+		for (int i = start / Plane::tone_block_size; i * Plane::tone_block_size < std::min(end, size); ++i) {
+			blocks[i] = true;
+		}
+		for (int i = 0; i * Plane::tone_block_size < end - size; ++i) {
+			blocks[i] = true;
+		}
+	}
+}
+
+void Plane::RefreshTone(const Rect& dst_rect, int src_x, int src_y) {
+	const int width = bitmap->GetWidth();
+	const int height = bitmap->GetHeight();
+	const int cols = (width + tone_block_size - 1) / tone_block_size;
+	const int rows = (height + tone_block_size - 1) / tone_block_size;
 
-	if (needs_refresh) {
+	if (needs_refresh || tone_effect != cached_tone) {
 		needs_refresh = false;
 
 		if (!tone_bitmap ||
-			bitmap->GetWidth() != tone_bitmap->GetWidth() ||
-			bitmap->GetHeight() != tone_bitmap->GetHeight()) {
-			tone_bitmap = Bitmap::Create(bitmap->GetWidth(), bitmap->GetHeight());
+			width != tone_bitmap->GetWidth() ||
+			height != tone_bitmap->GetHeight()) {
+			tone_bitmap = Bitmap::Create(width, height);
+		}
+
+		// Blocks are toned when they become visible, a gradual tint only
+		// processes the visible part of large panoramas each frame
+		cached_tone = tone_effect;
+		tone_blocks.assign(cols * rows, false);
+	}
+
+	std::vector<bool> visible_cols(cols);
+	std::vector<bool> visible_rows(rows);
+	MarkBlocks(visible_cols, src_x, dst_rect.width, width);
+	MarkBlocks(visible_rows, src_y, dst_rect.height, height);
+
+	for (int row = 0; row < rows; ++row) {
+		if (!visible_rows[row]) {
+			continue;
+		}
+		for (int col = 0; col < cols; ++col) {
+			if (!visible_cols[col] || tone_blocks[row * cols + col]) {
+				continue;
+			}
+
+			Rect rect(col * tone_block_size, row * tone_block_size, tone_block_size, tone_block_size);
+			rect.Adjust(width, height);
+
+			tone_bitmap->ClearRect(rect);
+			tone_bitmap->ToneBlit(rect.x, rect.y, *bitmap, rect, tone_effect, Opacity::Opaque());
+			tone_blocks[row * cols + col] = true;
 		}
-		tone_bitmap->Clear();
-		tone_bitmap->ToneBlit(0, 0, *bitmap, bitmap->GetRect(), tone_effect, Opacity::Opaque());
 	}
+}
 
-	BitmapRef source = tone_effect == Tone() ? bitmap : tone_bitmap;
+void Plane::Draw(Bitmap& dst) {
+	if (!bitmap) return;
 
 	Rect dst_rect = dst.GetRect();
 	int src_x = -ox;
@@ -87,6 +146,12 @@ void Plane::Draw(Bitmap& dst) {
 	}
 	src_y += shake_y;
 
+	BitmapRef source = bitmap;
+	if (tone_effect != Tone()) {
+		RefreshTone(dst_rect, src_x, src_y);
+		source = tone_bitmap;
+	}
+
 	dst.TiledBlit(src_x, src_y, source->GetRect(), *source, dst_rect, 255);
 }
 
@@ -22,7 +22,9 @@
 #include "system.h"
 #include "color.h"
 #include "drawable.h"
+#include "rect.h"
 #include "tone.h"
+#include <vector>
 
 /**
  * Plane class.
@@ -42,11 +44,28 @@ public:
 	Tone GetTone() const;
 	void SetTone(Tone tone);
 
+	/** Width and height of the blocks of the panorama that are toned on demand */
+	static constexpr int tone_block_size = 64;
+
 private:
+	/**
+	 * Applies the tone to the blocks of the panorama that are visible
+	 * in the destination and were not toned yet.
+	 *
+	 * @param dst_rect destination rectangle of the tiled blit
+	 * @param src_x source x at the left of dst_rect
+	 * @param src_y source y at the top of dst_rect
+	 */
+	void RefreshTone(const Rect& dst_rect, int src_x, int src_y);
+
 	BitmapRef bitmap;
 	BitmapRef tone_bitmap;
 
 	Tone tone_effect;
+	/** Tone of the blocks in tone_bitmap */
+	Tone cached_tone;
+	/** Which tone_bitmap blocks contain the toned panorama, row major */
+	std::vector<bool> tone_blocks;
 
 	int ox = 0;
 	int oy = 0;
@@ -84,10 +103,7 @@ inline Tone Plane::GetTone() const {
 }
 
 inline void Plane::SetTone(Tone tone) {
-	if (tone_effect != tone) {
-		tone_effect = tone;
-		needs_refresh = true;
-	}
+	tone_effect = tone;
 }
 
 #endif
@@ -20,7 +20,11 @@
 #include "filefinder.h"
 #include "utils.h"
 #include <cassert>
+#include <cstdio>
 #include <utility>
+#ifdef __vita__
+#  include <psp2/io/fcntl.h>
+#endif
 
 #ifndef DT_UNKNOWN
 #define DT_UNKNOWN 0
@@ -123,6 +127,28 @@ int64_t Platform::File::GetSize() const {
 #endif
 }
 
+int64_t Platform::File::GetModificationTime() const {
+#if defined(_WIN32)
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	BOOL res = ::GetFileAttributesExW(filename.c_str(),
+			GetFileExInfoStandard,
+			&data);
+	if (!res) {
+		return -1;
+	}
+
+	// 100ns intervals since 1601-01-01
+	int64_t ticks = ((int64_t)data.ftLastWriteTime.dwHighDateTime << 32) | (int64_t)data.ftLastWriteTime.dwLowDateTime;
+	return (ticks - 116444736000000000LL) / 10000000LL;
+#elif defined(__vita__)
+	return -1;
+#else
+	struct stat sb = {};
+	int result = ::stat(filename.c_str(), &sb);
+	return (result == 0) ? (int64_t)sb.st_mtime : (int64_t)-1;
+#endif
+}
+
 bool Platform::File::MakeDirectory(bool follow_symlinks) const {
 	if (IsDirectory(follow_symlinks)) {
 		return true;
@@ -182,6 +208,28 @@ bool Platform::File::MakeDirectory(bool follow_symlinks) const {
 	return true;
 }
 
+bool Platform::File::Rename(const std::string& new_name) const {
+#if defined(_WIN32)
+	return ::MoveFileExW(filename.c_str(), Utils::ToWideString(new_name).c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#elif defined(__vita__)
+	// Does not replace existing files
+	::sceIoRemove(new_name.c_str());
+	return ::sceIoRename(filename.c_str(), new_name.c_str()) >= 0;
+#else
+	return ::rename(filename.c_str(), new_name.c_str()) == 0;
+#endif
+}
+
+bool Platform::File::Remove() const {
+#if defined(_WIN32)
+	return ::DeleteFileW(filename.c_str()) != 0;
+#elif defined(__vita__)
+	return ::sceIoRemove(filename.c_str()) >= 0;
+#else
+	return ::remove(filename.c_str()) == 0;
+#endif
+}
+
 Platform::Directory::Directory(const std::string& name) {
 #if defined(_WIN32)
 	std::wstring wname = Utils::ToWideString((name.empty() ? "." : name) + "\\*");
@@ -89,6 +89,9 @@ namespace Platform {
 		/** @return Filesize or -1 on error */
 		int64_t GetSize() const;
 
+		/** @return Last modification time in seconds since the Unix epoch or -1 on error or when not supported */
+		int64_t GetModificationTime() const;
+
 		/**
 		 * Creates a directory recursively at the filename path.
 		 * @param follow_symlinks Whether to follow symlinks (if supported on this platform)
@@ -96,6 +99,19 @@ namespace Platform {
 		 */
 		bool MakeDirectory(bool follow_symlinks) const;
 
+		/**
+		 * Renames the file. An existing file at the destination is replaced.
+		 * @param new_name New path of the file
+		 * @return true when the file was renamed.
+		 */
+		bool Rename(const std::string& new_name) const;
+
+		/**
+		 * Deletes the file.
+		 * @return true when the file was deleted.
+		 */
+		bool Remove() const;
+
 	private:
 #ifdef _WIN32
 		const std::wstring filename;
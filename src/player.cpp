@@ -59,6 +59,9 @@
 #include "game_windows.h"
 #include "graphics.h"
 #include <lcf/inireader.h>
+#include "frame_capture.h"
+#include "frame_stats.h"
+#include "image_cache.h"
 #include "input.h"
 #include <lcf/ldb/reader.h>
 #include <lcf/lmt/reader.h>
@@ -68,6 +71,7 @@
 #include "player.h"
 #include <lcf/reader_lcf.h>
 #include <lcf/reader_util.h>
+#include "save_writer.h"
 #include "scene_battle.h"
 #include "scene_logo.h"
 #include "scene_map.h"
@@ -147,6 +151,14 @@ namespace {
 	// Overwritten by --encoding
 	std::string forced_encoding;
 
+	// Set by --frame-stats
+	bool frame_stats_flag = false;
+	std::string frame_stats_path;
+
+	// Set by --capture-frames
+	std::string capture_frames_path;
+	int capture_frames_interval = 1;
+
 	FileRequestBinding system_request_id;
 	FileRequestBinding save_request_id;
 	FileRequestBinding map_request_id;
@@ -197,7 +209,22 @@ void Player::Init(std::vector<std::string> args) {
 	Input::Init(cfg.input, replay_input_path, record_input_path);
 	Input::AddRecordingData(Input::RecordingData::CommandLine, command_line);
 
+	if (frame_stats_flag) {
+		FrameStats::Init(frame_stats_path);
+	}
+
+	if (!capture_frames_path.empty()) {
+		FrameCapture::Init(capture_frames_path, capture_frames_interval);
+	}
+
 	player_config = std::move(cfg.player);
+
+	if (player_config.image_cache.Get()) {
+		auto fs = Game_Config::GetGlobalConfigFilesystem();
+		if (fs && fs.MakeDirectory("image_cache", false)) {
+			ImageCache::Init(fs.Create("image_cache"));
+		}
+	}
 }
 
 void Player::Run() {
@@ -224,6 +251,9 @@ void Player::MainLoop() {
 	const auto frame_time = Game_Clock::now();
 	Game_Clock::OnNextFrame(frame_time);
 
+	auto frame_limit = DisplayUi->GetFrameLimit();
+	FrameStats::BeginFrame(frame_time, frame_limit == Game_Clock::duration() ? Game_Clock::GetTargetGameTimeStep() : frame_limit);
+
 	Player::UpdateInput();
 
 	int num_updates = 0;
@@ -243,6 +273,9 @@ void Player::MainLoop() {
 		// If no logical frames ran, we need to update the system keys only.
 		Input::UpdateSystem();
 	}
+	FrameStats::SetSteps(num_updates);
+	SaveWriter::Update();
+	FrameStats::EndPhase(FrameStats::Phase::Update);
 
 	Player::Draw();
 
@@ -253,7 +286,6 @@ void Player::MainLoop() {
 		return;
 	}
 
-	auto frame_limit = DisplayUi->GetFrameLimit();
 	if (frame_limit == Game_Clock::duration()) {
 #ifdef EMSCRIPTEN
 		emscripten_sleep(0);
@@ -281,7 +313,10 @@ void Player::Pause() {
 
 void Player::Resume() {
 	Input::ResetKeys();
-	Audio().BGM_Resume();
+	if (!Game_Clock::IsUnlimitedSpeed()) {
+		// BGM stays paused during unlimited fast forward
+		Audio().BGM_Resume();
+	}
 	Game_Clock::ResetFrame(Game_Clock::now());
 }
 
@@ -296,17 +331,28 @@ void Player::UpdateInput() {
 	if (Input::IsSystemTriggered(Input::SHOW_LOG)) {
 		Output::ToggleLog();
 	}
+	if (Input::IsSystemTriggered(Input::SAVE_TRACE)) {
+		Instrumentation::SaveTrace();
+	}
 	if (Input::IsSystemTriggered(Input::TOGGLE_ZOOM)) {
 		DisplayUi->ToggleZoom();
 	}
 	float speed = 1.0;
+	bool unlimited = false;
 	if (Input::IsSystemPressed(Input::FAST_FORWARD)) {
 		speed = speed_modifier;
 	}
 	if (Input::IsSystemPressed(Input::FAST_FORWARD_PLUS)) {
-		speed = speed_modifier_plus;
+		if (player_config.fast_forward_unlimited.Get()) {
+			unlimited = true;
+		} else {
+			speed = speed_modifier_plus;
+		}
+	}
+	SetUnlimitedFastForward(unlimited);
+	if (!unlimited) {
+		Game_Clock::SetGameSpeedFactor(speed);
 	}
-	Game_Clock::SetGameSpeedFactor(speed);
 
 	if (Main_Data::game_quit) {
 		reset_flag |= Main_Data::game_quit->ShouldQuit();
@@ -316,6 +362,23 @@ void Player::UpdateInput() {
 	DisplayUi->ProcessEvents();
 }
 
+void Player::SetUnlimitedFastForward(bool enabled) {
+	if (enabled == Game_Clock::IsUnlimitedSpeed()) {
+		return;
+	}
+
+	if (enabled) {
+		// Audio cannot keep up with the game, mute it while fast forwarding
+		Audio().BGM_Pause();
+		Audio().SE_Stop();
+		Game_Clock::SetUnlimitedSpeed(std::chrono::duration_cast<Game_Clock::duration>(
+			std::chrono::milliseconds(player_config.fast_forward_draw_interval.Get())));
+	} else {
+		Game_Clock::SetUnlimitedSpeed(Game_Clock::duration::zero());
+		Audio().BGM_Resume();
+	}
+}
+
 void Player::Update(bool update_scene) {
 	std::shared_ptr<Scene> old_instance = Scene::instance;
 
@@ -374,7 +437,10 @@ void Player::Update(bool update_scene) {
 void Player::Draw() {
 	Graphics::Update();
 	Graphics::Draw(*DisplayUi->GetDisplaySurface());
+	FrameCapture::Capture(*DisplayUi->GetDisplaySurface());
+	FrameStats::EndPhase(FrameStats::Phase::Draw);
 	DisplayUi->UpdateDisplay();
+	FrameStats::EndPhase(FrameStats::Phase::Present);
 }
 
 void Player::IncFrame() {
@@ -404,10 +470,14 @@ void Player::Exit() {
 	auto ret = FileFinder::Root().OpenOutputStream("/tmp/message.png", std::ios_base::binary | std::ios_base::out | std::ios_base::trunc);
 	if (ret) Output::TakeScreenshot(ret);
 #endif
+	SaveWriter::Flush();
 	Player::ResetGameObjects();
 	Font::Dispose();
 	DynRpg::Reset();
 	Graphics::Quit();
+	FrameCapture::Quit();
+	FrameStats::Quit();
+	Instrumentation::Quit();
 	Output::Quit();
 	FileFinder::Quit();
 	DisplayUi.reset();
@@ -602,6 +672,22 @@ Game_Config Player::ParseCommandLine() {
 			}
 			continue;
 		}
+		if (cp.ParseNext(arg, 1, "--frame-stats")) {
+			frame_stats_flag = true;
+			if (arg.NumValues() > 0) {
+				frame_stats_path = arg.Value(0);
+			}
+			continue;
+		}
+		if (cp.ParseNext(arg, 2, "--capture-frames")) {
+			if (arg.NumValues() > 0) {
+				capture_frames_path = arg.Value(0);
+			}
+			if (arg.ParseValue(1, li_value)) {
+				capture_frames_interval = li_value;
+			}
+			continue;
+		}
 		if (cp.ParseNext(arg, 1, "--replay-input")) {
 			if (arg.NumValues() > 0) {
 				replay_input_path = arg.Value(0);
@@ -1085,6 +1171,7 @@ static void OnMapSaveFileReady(FileRequestResult*, lcf::rpg::Save save) {
 }
 
 void Player::LoadSavegame(const std::string& save_name, int save_id) {
+	SaveWriter::Flush();
 	Output::Debug("Loading Save {}", save_name);
 
 	bool load_on_map = Scene::instance->type == Scene::Map;
@@ -1366,6 +1453,12 @@ Engine options:
                                  fixes.
                        ATTACK  - Like RPG_RT+ but only physical attacks, no
                                  skills.
+ --capture-frames PATH [N]
+                      Record every Nth presented frame (default 1). When PATH
+                      ends with .y4m the frames are appended to an uncompressed
+                      Y4M video, otherwise PATH is a folder that receives
+                      numbered PNG files. Frames are encoded in the background
+                      and dropped when the encoder falls behind.
  -c, --config-path P  Set a custom configuration path. When not specified, the
                       configuration folder in the users home directory is used.
  --encoding N         Instead of autodetecting the encoding or using the one in
@@ -1384,6 +1477,19 @@ Engine options:
                        rpg2k3     - RPG Maker 2003 (v1.00 - v1.04)
                        rpg2k3v105 - RPG Maker 2003 (v1.05 - v1.09a)
                        rpg2k3e    - RPG Maker 2003 (English release, v1.12)
+ --fast-forward-draw-interval MS
+                      Draw the screen only every MS milliseconds while
+                      unlimited fast forward is active. The default is 100.
+ --fast-forward-unlimited
+                      The Fast Forward+ key runs the game as fast as possible
+                      and mutes the audio. Disable with
+                      --no-fast-forward-unlimited.
+ --frame-stats [FILE] Show frame pacing statistics (time spent updating, drawing,
+                      presenting and sleeping, missed frames and a histogram of
+                      the frame times) below the FPS counter. When FILE is
+                      given the times of every frame are written to FILE (CSV).
+ --image-cache        Store decoded images in the configuration folder, so later
+                      runs load them faster. Disable with --no-image-cache.
  --language LANG      Load the game translation in language/LANG folder.
  --load-game-id N     Skip the title scene and load SaveN.lsd (N is padded to
                       two digits).
@@ -1427,6 +1533,8 @@ Video options:
                        original   - 320x240 (4:3). Recommended
                        widescreen - 416x240 (16:9)
                        ultrawide  - 560x240 (21:9)
+ --render-threads N   Draw the screen with N threads, each one renders a
+                      horizontal band of the screen. The default is 1.
  --scaling S          How the video output is scaled.
                       Options:
                        nearest  - Scale to screen size. Fast, but causes scaling
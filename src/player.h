@@ -97,6 +97,15 @@ namespace Player {
 	 */
 	void UpdateInput();
 
+	/**
+	 * Enables or disables unlimited fast forward. Logical frames run as fast as
+	 * possible and the screen is only drawn once per configured draw interval.
+	 * Audio is muted while active.
+	 *
+	 * @param enabled Whether unlimited fast forward is active
+	 */
+	void SetUnlimitedFastForward(bool enabled);
+
 	/**
 	 * Renders EasyRPG Player state to the screen
 	 */
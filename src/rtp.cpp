@@ -142,48 +142,94 @@ std::vector<RTP::RtpHitInfo> RTP::Detect(const FilesystemView& fs, int version,
 	return hit_list;
 }
 
-template <typename T>
-static std::vector<RTP::Type> lookup_any_to_rtp_helper(T rtp_table, const std::pair<int, int>& range,
+/**
+ * Binary searches an asset name in the sorted index of an RTP.
+ *
+ * @return range of matching entries in the sorted index
+ */
+template <typename T, typename S>
+static std::pair<int, int> find_sorted(T rtp_table, S sorted, const std::pair<int, int>& range,
+		StringView src_name, int rtp_index) {
+	auto name_at = [&](int k) {
+		return rtp_table[sorted[k][rtp_index]][rtp_index + 1];
+	};
+
+	// Rows without an asset are sorted last
+	int lo = range.first;
+	int hi = range.second;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		const char* name = name_at(mid);
+		if (name != nullptr && StringView(name) < src_name) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	const int first = lo;
+	hi = range.second;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		const char* name = name_at(mid);
+		if (name != nullptr && !(src_name < StringView(name))) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return {first, lo};
+}
+
+template <typename T, typename S>
+static std::vector<RTP::Type> lookup_any_to_rtp_helper(T rtp_table, S sorted, const std::pair<int, int>& range,
 		StringView src_name, int num_rtps, int offset) {
-	std::vector<RTP::Type> type_hits;
+	// (row, rtp) of all hits, reported in table order
+	std::vector<std::pair<int, int>> hits;
 
-	for (int i = range.first; i < range.second; ++i) {
-		for (int j = 1; j <= num_rtps; ++j) {
-			const char* name = rtp_table[i][j];
-			if (name != nullptr && src_name == StringView(name)) {
-				type_hits.push_back((RTP::Type)(j - 1 + offset));
-			}
+	for (int j = 0; j < num_rtps; ++j) {
+		auto found = find_sorted(rtp_table, sorted, range, src_name, j);
+		for (int k = found.first; k < found.second; ++k) {
+			hits.emplace_back(sorted[k][j], j);
 		}
 	}
 
+	std::sort(hits.begin(), hits.end());
+
+	std::vector<RTP::Type> type_hits;
+	type_hits.reserve(hits.size());
+	for (auto& hit: hits) {
+		type_hits.push_back((RTP::Type)(hit.second + offset));
+	}
+
 	return type_hits;
 }
 
 std::vector<RTP::Type> RTP::LookupAnyToRtp(StringView src_category, StringView src_name, int version) {
 	if (version == 2000) {
 		auto tbl_idx = get_table_idx(rtp_table_2k_categories, rtp_table_2k_categories_idx, src_category);
-		return lookup_any_to_rtp_helper(rtp_table_2k, tbl_idx, src_name, num_2k_rtps, 0);
+		return lookup_any_to_rtp_helper(rtp_table_2k, rtp_table_2k_sorted, tbl_idx, src_name, num_2k_rtps, 0);
 	} else {
 		auto tbl_idx = get_table_idx(rtp_table_2k3_categories, rtp_table_2k3_categories_idx, src_category);
-		return lookup_any_to_rtp_helper(rtp_table_2k3, tbl_idx, src_name, num_2k3_rtps, num_2k_rtps);
+		return lookup_any_to_rtp_helper(rtp_table_2k3, rtp_table_2k3_sorted, tbl_idx, src_name, num_2k3_rtps, num_2k_rtps);
 	}
 }
 
-template <typename T>
-static std::string lookup_rtp_to_rtp_helper(T rtp_table, const std::pair<int, int>& range,
+template <typename T, typename S>
+static std::string lookup_rtp_to_rtp_helper(T rtp_table, S sorted, const std::pair<int, int>& range,
 		StringView src_name, int src_index, int dst_index, bool* is_rtp_asset) {
 
-	for (int i = range.first; i < range.second; ++i) {
-		const char* name = rtp_table[i][src_index + 1];
-		if (name != nullptr && src_name == StringView(name)) {
-			const char* dst_name = rtp_table[i][dst_index + 1];
-
-			if (is_rtp_asset) {
-				*is_rtp_asset = true;
-			}
+	auto found = find_sorted(rtp_table, sorted, range, src_name, src_index);
+	if (found.first != found.second) {
+		// Equal names are sorted by row, this is the first match in the table
+		const char* dst_name = rtp_table[sorted[found.first][src_index]][dst_index + 1];
 
-			return dst_name == nullptr ? "" : dst_name;
+		if (is_rtp_asset) {
+			*is_rtp_asset = true;
 		}
+
+		return dst_name == nullptr ? "" : dst_name;
 	}
 
 	if (is_rtp_asset) {
@@ -209,9 +255,9 @@ std::string RTP::LookupRtpToRtp(StringView src_category, StringView src_name, RT
 
 	if ((int)src_rtp < num_2k_rtps) {
 		auto tbl_idx = get_table_idx(rtp_table_2k_categories, rtp_table_2k_categories_idx, src_category);
-		return lookup_rtp_to_rtp_helper(rtp_table_2k, tbl_idx, src_name, (int)src_rtp, (int)target_rtp, is_rtp_asset);
+		return lookup_rtp_to_rtp_helper(rtp_table_2k, rtp_table_2k_sorted, tbl_idx, src_name, (int)src_rtp, (int)target_rtp, is_rtp_asset);
 	} else {
 		auto tbl_idx = get_table_idx(rtp_table_2k3_categories, rtp_table_2k3_categories_idx, src_category);
-		return lookup_rtp_to_rtp_helper(rtp_table_2k3, tbl_idx, src_name, (int)src_rtp - num_2k_rtps, (int)target_rtp - num_2k_rtps, is_rtp_asset);
+		return lookup_rtp_to_rtp_helper(rtp_table_2k3, rtp_table_2k3_sorted, tbl_idx, src_name, (int)src_rtp - num_2k_rtps, (int)target_rtp - num_2k_rtps, is_rtp_asset);
 	}
 }
@@ -18,6 +18,7 @@
 #ifndef EP_RTP_H
 #define EP_RTP_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,9 @@ namespace RTP {
 	extern const char* const rtp_table_2k3_categories[16];
 	extern const int rtp_table_2k_categories_idx[15];
 	extern const int rtp_table_2k3_categories_idx[16];
+	// For every RTP the rows of the table sorted by asset name inside every category
+	extern const int16_t rtp_table_2k_sorted[][num_2k_rtps];
+	extern const int16_t rtp_table_2k3_sorted[][num_2k3_rtps];
 
 	enum class Type {
 		RPG2000_OfficialJapanese,
@@ -1081,6 +1081,1016 @@ const int rtp_table_2k_categories_idx[15] = {
 	1006
 };
 
+const int16_t rtp_table_2k_sorted[][4] = {
+	{0, 11, 4, 25},
+	{1, 17, 11, 26},
+	{2, 23, 6, 27},
+	{3, 0, 14, 28},
+	{4, 1, 0, 29},
+	{5, 2, 3, 30},
+	{6, 3, 17, 31},
+	{7, 4, 9, 32},
+	{8, 9, 10, 33},
+	{9, 10, 5, 34},
+	{10, 21, 21, 35},
+	{11, 6, 18, 36},
+	{12, 12, 2, 37},
+	{13, 7, 1, 38},
+	{14, 8, 15, 0},
+	{15, 16, 13, 1},
+	{16, 13, 16, 2},
+	{17, 20, 20, 3},
+	{18, 18, 19, 4},
+	{19, 19, 24, 5},
+	{20, 24, 7, 6},
+	{21, 5, 12, 7},
+	{22, 15, 23, 8},
+	{23, 14, 22, 9},
+	{24, 22, 8, 10},
+	{25, 25, 25, 11},
+	{26, 26, 26, 12},
+	{27, 27, 27, 13},
+	{28, 28, 28, 14},
+	{29, 29, 29, 15},
+	{30, 30, 30, 16},
+	{31, 31, 31, 17},
+	{32, 32, 32, 18},
+	{33, 33, 33, 19},
+	{34, 34, 34, 20},
+	{35, 35, 35, 21},
+	{36, 36, 36, 22},
+	{37, 37, 37, 23},
+	{38, 38, 38, 24},
+	{39, 60, 47, 67},
+	{40, 51, 60, 68},
+	{41, 40, 51, 39},
+	{42, 47, 40, 40},
+	{43, 50, 44, 41},
+	{44, 41, 52, 42},
+	{45, 42, 43, 43},
+	{46, 59, 49, 44},
+	{47, 52, 39, 45},
+	{48, 43, 58, 46},
+	{49, 49, 59, 47},
+	{50, 58, 56, 48},
+	{51, 56, 57, 49},
+	{52, 57, 50, 50},
+	{53, 61, 61, 51},
+	{54, 44, 66, 52},
+	{55, 39, 41, 53},
+	{56, 66, 62, 54},
+	{57, 48, 53, 55},
+	{58, 62, 55, 56},
+	{59, 53, 48, 57},
+	{60, 45, 45, 58},
+	{61, 46, 46, 59},
+	{62, 63, 42, 60},
+	{63, 55, 54, 61},
+	{64, 54, 64, 62},
+	{65, 64, 65, 63},
+	{66, 65, 63, 64},
+	{67, 67, 67, 65},
+	{68, 68, 68, 66},
+	{69, 78, 83, 98},
+	{70, 79, 78, 99},
+	{71, 80, 79, 100},
+	{72, 81, 80, 101},
+	{73, 83, 81, 102},
+	{74, 71, 84, 103},
+	{75, 72, 85, 104},
+	{76, 69, 86, 105},
+	{77, 70, 87, 106},
+	{78, 73, 88, 107},
+	{79, 74, 89, 108},
+	{80, 75, 90, 109},
+	{81, 76, 91, 110},
+	{82, 77, 92, 111},
+	{83, 82, 93, 112},
+	{84, 84, 94, 113},
+	{85, 85, 95, 114},
+	{86, 86, 96, 115},
+	{87, 87, 71, 116},
+	{88, 88, 72, 117},
+	{89, 89, 69, 118},
+	{90, 90, 70, 119},
+	{91, 91, 73, 120},
+	{92, 92, 75, 121},
+	{93, 93, 76, 122},
+	{94, 94, 77, 123},
+	{95, 95, 74, 124},
+	{96, 96, 82, 125},
+	{97, 97, 97, 126},
+	{98, 98, 98, 127},
+	{99, 99, 99, 130},
+	{100, 100, 100, 131},
+	{101, 101, 101, 132},
+	{102, 102, 102, 133},
+	{103, 103, 103, 128},
+	{104, 104, 104, 129},
+	{105, 105, 105, 134},
+	{106, 106, 106, 135},
+	{107, 107, 107, 136},
+	{108, 108, 108, 137},
+	{109, 109, 109, 138},
+	{110, 110, 110, 139},
+	{111, 111, 111, 140},
+	{112, 112, 112, 141},
+	{113, 113, 113, 142},
+	{114, 114, 114, 153},
+	{115, 115, 115, 143},
+	{116, 116, 116, 144},
+	{117, 117, 117, 145},
+	{118, 118, 118, 146},
+	{119, 119, 119, 147},
+	{120, 120, 120, 148},
+	{121, 121, 121, 149},
+	{122, 122, 122, 150},
+	{123, 123, 123, 151},
+	{124, 124, 124, 152},
+	{125, 125, 125, 163},
+	{126, 126, 126, 154},
+	{127, 127, 127, 155},
+	{128, 128, 128, 156},
+	{129, 129, 129, 157},
+	{130, 130, 130, 158},
+	{131, 131, 131, 159},
+	{132, 132, 132, 160},
+	{133, 133, 133, 161},
+	{134, 134, 134, 162},
+	{135, 135, 135, 164},
+	{136, 136, 136, 165},
+	{137, 137, 137, 166},
+	{138, 138, 138, 167},
+	{139, 139, 139, 168},
+	{140, 140, 140, 169},
+	{141, 141, 141, 170},
+	{142, 142, 142, 171},
+	{143, 143, 143, 172},
+	{144, 144, 144, 173},
+	{145, 145, 145, 174},
+	{146, 146, 146, 175},
+	{147, 147, 147, 176},
+	{148, 148, 148, 177},
+	{149, 149, 149, 178},
+	{150, 150, 150, 179},
+	{151, 151, 151, 180},
+	{152, 152, 152, 181},
+	{153, 153, 153, 182},
+	{154, 154, 154, 183},
+	{155, 155, 155, 184},
+	{156, 156, 156, 185},
+	{157, 157, 157, 186},
+	{158, 158, 158, 187},
+	{159, 159, 159, 188},
+	{160, 160, 160, 189},
+	{161, 161, 161, 190},
+	{162, 162, 162, 191},
+	{163, 163, 163, 192},
+	{164, 164, 164, 193},
+	{165, 165, 165, 194},
+	{166, 166, 166, 195},
+	{167, 167, 167, 196},
+	{168, 168, 168, 197},
+	{169, 169, 169, 198},
+	{170, 170, 170, 199},
+	{171, 171, 171, 200},
+	{172, 172, 172, 201},
+	{173, 173, 173, 202},
+	{174, 174, 174, 203},
+	{175, 175, 175, 204},
+	{176, 176, 176, 205},
+	{177, 177, 177, 206},
+	{178, 178, 178, 207},
+	{179, 179, 179, 208},
+	{180, 180, 180, 209},
+	{181, 181, 181, 210},
+	{182, 182, 182, 211},
+	{183, 183, 183, 212},
+	{184, 184, 184, 213},
+	{185, 185, 185, 214},
+	{186, 186, 186, 215},
+	{187, 187, 187, 216},
+	{188, 188, 188, 217},
+	{189, 189, 189, 218},
+	{190, 190, 190, 219},
+	{191, 191, 191, 220},
+	{192, 192, 192, 221},
+	{193, 193, 193, 222},
+	{194, 194, 194, 223},
+	{195, 195, 195, 224},
+	{196, 196, 196, 225},
+	{197, 197, 197, 226},
+	{198, 198, 198, 227},
+	{199, 199, 199, 228},
+	{200, 200, 200, 229},
+	{201, 201, 201, 230},
+	{202, 202, 202, 231},
+	{203, 203, 203, 232},
+	{204, 204, 204, 233},
+	{205, 205, 205, 237},
+	{206, 206, 206, 234},
+	{207, 207, 207, 235},
+	{208, 208, 208, 236},
+	{209, 209, 209, 238},
+	{210, 210, 210, 239},
+	{211, 211, 211, 240},
+	{212, 212, 212, 241},
+	{213, 213, 213, 242},
+	{214, 214, 214, 243},
+	{215, 215, 215, 244},
+	{216, 216, 216, 245},
+	{217, 217, 217, 246},
+	{218, 218, 218, 247},
+	{219, 219, 219, 248},
+	{220, 220, 220, 249},
+	{221, 221, 221, 250},
+	{222, 222, 222, 251},
+	{223, 223, 223, 252},
+	{224, 224, 224, 253},
+	{225, 225, 225, 254},
+	{226, 226, 226, 255},
+	{227, 227, 227, 256},
+	{228, 228, 228, 258},
+	{229, 229, 229, 257},
+	{230, 230, 230, 259},
+	{231, 231, 231, 260},
+	{232, 232, 232, 261},
+	{233, 233, 233, 262},
+	{234, 234, 234, 263},
+	{235, 235, 235, 264},
+	{236, 236, 236, 265},
+	{237, 237, 237, 266},
+	{238, 238, 238, 267},
+	{239, 239, 239, 268},
+	{240, 240, 240, 270},
+	{241, 241, 241, 269},
+	{242, 242, 242, 271},
+	{243, 243, 243, 272},
+	{244, 244, 244, 273},
+	{245, 245, 245, 274},
+	{246, 246, 246, 275},
+	{247, 247, 247, 276},
+	{248, 248, 248, 280},
+	{249, 249, 249, 278},
+	{250, 250, 250, 277},
+	{251, 251, 251, 279},
+	{252, 252, 252, 281},
+	{253, 253, 253, 69},
+	{254, 254, 254, 70},
+	{255, 255, 255, 71},
+	{256, 256, 256, 72},
+	{257, 257, 257, 73},
+	{258, 258, 258, 74},
+	{259, 259, 259, 75},
+	{260, 260, 260, 76},
+	{261, 261, 261, 77},
+	{262, 262, 262, 78},
+	{263, 263, 263, 79},
+	{264, 264, 264, 80},
+	{265, 265, 265, 81},
+	{266, 266, 266, 82},
+	{267, 267, 267, 83},
+	{268, 268, 268, 84},
+	{269, 269, 269, 85},
+	{270, 270, 270, 86},
+	{271, 271, 271, 87},
+	{272, 272, 272, 88},
+	{273, 273, 273, 89},
+	{274, 274, 274, 90},
+	{275, 275, 275, 91},
+	{276, 276, 276, 92},
+	{277, 277, 277, 93},
+	{278, 278, 278, 94},
+	{279, 279, 279, 95},
+	{280, 280, 280, 96},
+	{281, 281, 281, 97},
+	{282, 282, 284, 290},
+	{283, 285, 287, 291},
+	{284, 283, 288, 292},
+	{285, 286, 289, 293},
+	{286, 284, 282, 294},
+	{287, 287, 283, 298},
+	{288, 288, 285, 295},
+	{289, 289, 286, 296},
+	{290, 290, 290, 297},
+	{291, 291, 291, 299},
+	{292, 292, 292, 303},
+	{293, 293, 293, 302},
+	{294, 294, 294, 301},
+	{295, 295, 295, 300},
+	{296, 296, 296, 304},
+	{297, 297, 297, 305},
+	{298, 298, 298, 307},
+	{299, 299, 299, 306},
+	{300, 300, 300, 308},
+	{301, 301, 301, 310},
+	{302, 302, 302, 309},
+	{303, 303, 303, 311},
+	{304, 304, 304, 313},
+	{305, 305, 305, 312},
+	{306, 306, 306, 314},
+	{307, 307, 307, 315},
+	{308, 308, 308, 316},
+	{309, 309, 309, 317},
+	{310, 310, 310, 318},
+	{311, 311, 311, 319},
+	{312, 312, 312, 321},
+	{313, 313, 313, 322},
+	{314, 314, 314, 325},
+	{315, 315, 315, 328},
+	{316, 316, 316, 326},
+	{317, 317, 317, 327},
+	{318, 318, 318, 331},
+	{319, 319, 319, 329},
+	{320, 320, 320, 330},
+	{321, 321, 321, 332},
+	{322, 322, 322, 333},
+	{323, 323, 323, 334},
+	{324, 324, 324, 320},
+	{325, 325, 325, 323},
+	{326, 326, 326, 324},
+	{327, 327, 327, 335},
+	{328, 328, 328, 336},
+	{329, 329, 329, 337},
+	{330, 330, 330, 338},
+	{331, 331, 331, 339},
+	{332, 332, 332, 340},
+	{333, 333, 333, 342},
+	{334, 334, 334, 341},
+	{335, 335, 335, 343},
+	{336, 336, 336, 344},
+	{337, 337, 337, 348},
+	{338, 338, 338, 345},
+	{339, 339, 339, 346},
+	{340, 340, 340, 347},
+	{341, 341, 341, 349},
+	{342, 342, 342, 350},
+	{343, 343, 343, 351},
+	{344, 344, 344, 352},
+	{345, 345, 345, 353},
+	{346, 346, 346, 354},
+	{347, 347, 347, 355},
+	{348, 348, 348, 356},
+	{349, 349, 349, 361},
+	{350, 350, 350, 357},
+	{351, 351, 351, 358},
+	{352, 352, 352, 359},
+	{353, 353, 353, 360},
+	{354, 354, 354, 362},
+	{355, 355, 355, 366},
+	{356, 356, 356, 363},
+	{357, 357, 357, 364},
+	{358, 358, 358, 365},
+	{359, 359, 359, 367},
+	{360, 360, 360, 368},
+	{361, 361, 361, 369},
+	{362, 362, 362, 374},
+	{363, 363, 363, 370},
+	{364, 364, 364, 371},
+	{365, 365, 365, 372},
+	{366, 366, 366, 373},
+	{367, 367, 367, 375},
+	{368, 368, 368, 376},
+	{369, 369, 369, 377},
+	{370, 370, 370, 378},
+	{371, 371, 371, 379},
+	{372, 372, 372, 380},
+	{373, 373, 373, 381},
+	{374, 374, 374, 382},
+	{375, 375, 375, 383},
+	{376, 376, 376, 384},
+	{377, 377, 377, 388},
+	{378, 378, 378, 385},
+	{379, 379, 379, 386},
+	{380, 380, 380, 387},
+	{381, 381, 381, 391},
+	{382, 382, 382, 390},
+	{383, 383, 383, 389},
+	{384, 384, 384, 392},
+	{385, 385, 385, 393},
+	{386, 386, 386, 394},
+	{387, 387, 387, 395},
+	{388, 388, 388, 397},
+	{389, 389, 389, 396},
+	{390, 390, 390, 398},
+	{391, 391, 391, 400},
+	{392, 392, 392, 399},
+	{393, 393, 393, 402},
+	{394, 394, 394, 403},
+	{395, 395, 395, 404},
+	{396, 396, 396, 401},
+	{397, 397, 397, 405},
+	{398, 398, 398, 406},
+	{399, 399, 399, 408},
+	{400, 400, 400, 407},
+	{401, 401, 401, 409},
+	{402, 402, 402, 410},
+	{403, 403, 403, 412},
+	{404, 404, 404, 411},
+	{405, 405, 405, 413},
+	{406, 406, 406, 416},
+	{407, 407, 407, 414},
+	{408, 408, 408, 415},
+	{409, 409, 409, 417},
+	{410, 410, 410, 282},
+	{411, 411, 411, 283},
+	{412, 412, 412, 284},
+	{413, 413, 413, 285},
+	{414, 414, 414, 286},
+	{415, 415, 415, 287},
+	{416, 416, 416, 288},
+	{417, 417, 417, 289},
+	{418, 421, 421, 427},
+	{419, 422, 422, 429},
+	{420, 418, 423, 428},
+	{421, 419, 424, 430},
+	{422, 420, 425, 431},
+	{423, 423, 426, 435},
+	{424, 424, 418, 432},
+	{425, 425, 419, 433},
+	{426, 426, 420, 434},
+	{427, 427, 427, 436},
+	{428, 428, 428, 437},
+	{429, 429, 429, 438},
+	{430, 430, 430, 439},
+	{431, 431, 431, 447},
+	{432, 432, 432, 440},
+	{433, 433, 433, 441},
+	{434, 434, 434, 443},
+	{435, 435, 435, 442},
+	{436, 436, 436, 445},
+	{437, 437, 437, 446},
+	{438, 438, 438, 444},
+	{439, 439, 439, 448},
+	{440, 440, 440, 449},
+	{441, 441, 441, 450},
+	{442, 442, 442, 451},
+	{443, 443, 443, 457},
+	{444, 444, 444, 452},
+	{445, 445, 445, 453},
+	{446, 446, 446, 454},
+	{447, 447, 447, 456},
+	{448, 448, 448, 455},
+	{449, 449, 449, 458},
+	{450, 450, 450, 459},
+	{451, 451, 451, 460},
+	{452, 452, 452, 461},
+	{453, 453, 453, 462},
+	{454, 454, 454, 464},
+	{455, 455, 455, 463},
+	{456, 456, 456, 466},
+	{457, 457, 457, 465},
+	{458, 458, 458, 469},
+	{459, 459, 459, 467},
+	{460, 460, 460, 468},
+	{461, 461, 461, 472},
+	{462, 462, 462, 470},
+	{463, 463, 463, 471},
+	{464, 464, 464, 473},
+	{465, 465, 465, 474},
+	{466, 466, 466, 477},
+	{467, 467, 467, 475},
+	{468, 468, 468, 476},
+	{469, 469, 469, 478},
+	{470, 470, 470, 480},
+	{471, 471, 471, 479},
+	{472, 472, 472, 481},
+	{473, 473, 473, 484},
+	{474, 474, 474, 482},
+	{475, 475, 475, 483},
+	{476, 476, 476, 485},
+	{477, 477, 477, 487},
+	{478, 478, 478, 486},
+	{479, 479, 479, 488},
+	{480, 480, 480, 489},
+	{481, 481, 481, 490},
+	{482, 482, 482, 491},
+	{483, 483, 483, 492},
+	{484, 484, 484, 494},
+	{485, 485, 485, 493},
+	{486, 486, 486, 495},
+	{487, 487, 487, 497},
+	{488, 488, 488, 496},
+	{489, 489, 489, 499},
+	{490, 490, 490, 498},
+	{491, 491, 491, 500},
+	{492, 492, 492, 501},
+	{493, 493, 493, 502},
+	{494, 494, 494, 503},
+	{495, 495, 495, 504},
+	{496, 496, 496, 505},
+	{497, 497, 497, 508},
+	{498, 498, 498, 507},
+	{499, 499, 499, 506},
+	{500, 500, 500, 511},
+	{501, 501, 501, 509},
+	{502, 502, 502, 510},
+	{503, 503, 503, 513},
+	{504, 504, 504, 512},
+	{505, 505, 505, 514},
+	{506, 506, 506, 519},
+	{507, 507, 507, 518},
+	{508, 508, 508, 515},
+	{509, 509, 509, 516},
+	{510, 510, 510, 517},
+	{511, 511, 511, 520},
+	{512, 512, 512, 418},
+	{513, 513, 513, 419},
+	{514, 514, 514, 420},
+	{515, 515, 515, 421},
+	{516, 516, 516, 422},
+	{517, 517, 517, 423},
+	{518, 518, 518, 424},
+	{519, 519, 519, 425},
+	{520, 520, 520, 426},
+	{521, 521, 521, 521},
+	{529, 570, 570, 587},
+	{523, 529, 548, 588},
+	{524, 546, 529, 589},
+	{525, 528, 547, 590},
+	{526, 525, 556, 591},
+	{527, 532, 557, 592},
+	{528, 538, 559, 593},
+	{532, 539, 525, 594},
+	{534, 583, 582, 595},
+	{533, 582, 538, 596},
+	{530, 541, 546, 597},
+	{531, 540, 542, 598},
+	{535, 586, 554, 599},
+	{536, 565, 577, 600},
+	{537, 524, 541, 601},
+	{538, 530, 581, 602},
+	{539, 568, 573, 603},
+	{542, 567, 539, 604},
+	{543, 533, 524, 605},
+	{540, 531, 530, 606},
+	{541, 527, 558, 607},
+	{544, 544, 560, 608},
+	{545, 547, 562, 609},
+	{546, 545, 578, 610},
+	{547, 579, 531, 611},
+	{549, 542, 564, 612},
+	{548, 534, 540, 522},
+	{550, 526, 586, 523},
+	{551, 554, 527, 524},
+	{552, 553, 544, 525},
+	{553, 584, 528, 526},
+	{554, 585, 574, 527},
+	{556, 552, 575, 528},
+	{555, 548, 523, 529},
+	{522, 551, 545, 530},
+	{557, 550, 565, 531},
+	{558, 573, 579, 532},
+	{559, 549, 553, 533},
+	{560, 572, 561, 534},
+	{561, 523, 552, 535},
+	{562, 557, 550, 536},
+	{563, 558, 549, 537},
+	{564, 559, 572, 538},
+	{565, 560, 543, 539},
+	{566, 561, 526, 540},
+	{567, 562, 551, 541},
+	{568, 563, 563, 542},
+	{569, 564, 571, 543},
+	{570, 578, 568, 544},
+	{571, 571, 532, 545},
+	{572, 577, 576, 546},
+	{573, 535, 583, 547},
+	{574, 536, 535, 548},
+	{575, 569, 536, 549},
+	{576, 566, 569, 550},
+	{577, 580, 567, 551},
+	{578, 543, 580, 552},
+	{579, 522, 533, 553},
+	{580, 576, 522, 554},
+	{581, 574, 566, 555},
+	{582, 575, 584, 556},
+	{583, 555, 585, 557},
+	{584, 581, 555, 558},
+	{585, 556, 534, 559},
+	{586, 537, 537, 560},
+	{587, 587, 587, 561},
+	{588, 588, 588, 562},
+	{589, 589, 589, 563},
+	{590, 590, 590, 564},
+	{591, 591, 591, 565},
+	{592, 592, 592, 566},
+	{593, 593, 593, 567},
+	{594, 594, 594, 568},
+	{595, 595, 595, 569},
+	{596, 596, 596, 570},
+	{597, 597, 597, 571},
+	{598, 598, 598, 572},
+	{599, 599, 599, 573},
+	{600, 600, 600, 574},
+	{601, 601, 601, 575},
+	{602, 602, 602, 576},
+	{603, 603, 603, 577},
+	{604, 604, 604, 578},
+	{605, 605, 605, 579},
+	{606, 606, 606, 580},
+	{607, 607, 607, 581},
+	{608, 608, 608, 582},
+	{609, 609, 609, 583},
+	{610, 610, 610, 584},
+	{611, 611, 611, 585},
+	{612, 612, 612, 586},
+	{613, 613, 613, 613},
+	{614, 684, 684, 725},
+	{615, 668, 668, 726},
+	{616, 686, 686, 727},
+	{617, 687, 687, 728},
+	{618, 688, 688, 729},
+	{619, 625, 625, 730},
+	{620, 626, 626, 731},
+	{621, 627, 627, 732},
+	{622, 628, 628, 733},
+	{623, 709, 657, 734},
+	{624, 657, 658, 735},
+	{625, 658, 659, 736},
+	{626, 659, 660, 737},
+	{627, 660, 670, 738},
+	{628, 670, 671, 739},
+	{629, 671, 672, 740},
+	{630, 672, 691, 614},
+	{631, 691, 652, 615},
+	{632, 633, 709, 616},
+	{633, 652, 710, 617},
+	{634, 690, 629, 618},
+	{635, 710, 647, 619},
+	{636, 647, 648, 620},
+	{637, 648, 649, 621},
+	{638, 649, 650, 622},
+	{639, 650, 651, 623},
+	{640, 651, 711, 624},
+	{641, 631, 712, 625},
+	{642, 636, 636, 626},
+	{643, 637, 637, 627},
+	{644, 638, 638, 628},
+	{645, 697, 697, 629},
+	{646, 676, 676, 630},
+	{647, 677, 677, 631},
+	{648, 617, 617, 632},
+	{649, 618, 618, 633},
+	{650, 619, 619, 634},
+	{651, 620, 620, 635},
+	{652, 621, 621, 636},
+	{653, 622, 622, 637},
+	{654, 664, 664, 638},
+	{655, 665, 665, 639},
+	{656, 653, 713, 640},
+	{657, 654, 714, 641},
+	{658, 655, 653, 642},
+	{659, 656, 654, 643},
+	{660, 615, 655, 644},
+	{661, 616, 656, 645},
+	{662, 642, 692, 646},
+	{663, 643, 615, 647},
+	{664, 644, 616, 648},
+	{665, 645, 642, 649},
+	{666, 646, 643, 650},
+	{667, 666, 644, 651},
+	{668, 667, 669, 652},
+	{669, 623, 645, 653},
+	{670, 624, 646, 654},
+	{671, 614, 666, 655},
+	{672, 692, 667, 656},
+	{673, 630, 623, 657},
+	{674, 701, 624, 658},
+	{675, 702, 715, 659},
+	{676, 703, 614, 660},
+	{677, 639, 690, 661},
+	{678, 640, 701, 662},
+	{679, 641, 702, 663},
+	{680, 678, 703, 664},
+	{681, 679, 716, 665},
+	{682, 680, 717, 666},
+	{683, 635, 639, 667},
+	{684, 632, 640, 668},
+	{685, 634, 641, 669},
+	{686, 689, 678, 670},
+	{687, 705, 679, 671},
+	{688, 706, 680, 672},
+	{689, 707, 718, 673},
+	{690, 685, 719, 674},
+	{691, 681, 720, 675},
+	{692, 682, 721, 676},
+	{693, 683, 630, 677},
+	{694, 629, 661, 678},
+	{695, 696, 662, 679},
+	{696, 673, 663, 680},
+	{697, 674, 722, 681},
+	{698, 675, 685, 682},
+	{699, 698, 689, 683},
+	{700, 699, 633, 684},
+	{701, 700, 631, 685},
+	{702, 704, 635, 686},
+	{703, 708, 632, 687},
+	{704, 661, 634, 688},
+	{705, 662, 705, 689},
+	{706, 663, 706, 690},
+	{707, 669, 707, 691},
+	{708, 693, 681, 692},
+	{709, 694, 682, 693},
+	{710, 695, 683, 694},
+	{711, 711, 723, 695},
+	{712, 712, 724, 696},
+	{713, 713, 696, 697},
+	{714, 714, 673, 698},
+	{715, 715, 674, 699},
+	{716, 716, 675, 700},
+	{717, 717, 698, 701},
+	{718, 718, 699, 702},
+	{719, 719, 700, 703},
+	{720, 720, 704, 704},
+	{721, 721, 708, 705},
+	{722, 722, 693, 706},
+	{723, 723, 694, 707},
+	{724, 724, 695, 708},
+	{725, 725, 725, 709},
+	{726, 726, 726, 710},
+	{727, 727, 727, 711},
+	{728, 728, 728, 712},
+	{729, 729, 729, 713},
+	{730, 730, 730, 714},
+	{731, 731, 731, 715},
+	{732, 732, 732, 716},
+	{733, 733, 733, 717},
+	{734, 734, 734, 718},
+	{735, 735, 735, 719},
+	{736, 736, 736, 720},
+	{737, 737, 737, 721},
+	{738, 738, 738, 722},
+	{739, 739, 739, 723},
+	{740, 740, 740, 724},
+	{741, 747, 741, 754},
+	{742, 743, 742, 741},
+	{743, 744, 743, 742},
+	{744, 751, 744, 743},
+	{745, 745, 747, 744},
+	{746, 746, 752, 745},
+	{747, 748, 753, 746},
+	{748, 749, 745, 747},
+	{749, 750, 746, 748},
+	{750, 752, 748, 749},
+	{751, 753, 749, 750},
+	{752, 741, 750, 751},
+	{753, 742, 751, 752},
+	{754, 754, 754, 753},
+	{755, 755, 755, 755},
+	{758, 817, 817, 962},
+	{759, 818, 818, 963},
+	{764, 856, 890, 964},
+	{770, 857, 891, 965},
+	{771, 792, 856, 966},
+	{772, 832, 857, 967},
+	{786, 833, 792, 968},
+	{787, 928, 928, 969},
+	{790, 819, 819, 970},
+	{791, 870, 849, 971},
+	{793, 849, 850, 972},
+	{756, 850, 851, 973},
+	{757, 851, 852, 974},
+	{760, 852, 853, 975},
+	{761, 853, 854, 976},
+	{762, 854, 855, 977},
+	{763, 855, 845, 756},
+	{765, 845, 846, 757},
+	{766, 846, 799, 758},
+	{767, 799, 794, 759},
+	{768, 760, 795, 760},
+	{769, 790, 768, 761},
+	{775, 791, 769, 762},
+	{776, 794, 788, 763},
+	{777, 795, 892, 764},
+	{773, 768, 787, 765},
+	{774, 769, 869, 766},
+	{778, 788, 929, 767},
+	{779, 787, 930, 768},
+	{780, 758, 803, 769},
+	{781, 759, 812, 770},
+	{782, 869, 813, 771},
+	{783, 929, 804, 772},
+	{784, 930, 805, 773},
+	{785, 890, 806, 774},
+	{788, 891, 807, 775},
+	{789, 847, 808, 776},
+	{792, 848, 809, 777},
+	{796, 892, 810, 778},
+	{797, 762, 811, 779},
+	{798, 765, 762, 780},
+	{794, 766, 765, 781},
+	{795, 781, 766, 782},
+	{799, 782, 781, 783},
+	{800, 871, 782, 784},
+	{801, 872, 871, 785},
+	{802, 873, 872, 786},
+	{803, 874, 873, 787},
+	{812, 875, 874, 788},
+	{813, 876, 875, 789},
+	{804, 780, 870, 790},
+	{805, 885, 885, 791},
+	{806, 886, 886, 792},
+	{807, 761, 761, 793},
+	{808, 834, 780, 794},
+	{809, 843, 834, 795},
+	{810, 835, 843, 796},
+	{811, 836, 835, 797},
+	{814, 837, 836, 798},
+	{815, 838, 837, 799},
+	{816, 839, 838, 800},
+	{817, 840, 839, 801},
+	{818, 841, 840, 802},
+	{819, 842, 841, 803},
+	{820, 830, 842, 804},
+	{821, 831, 830, 805},
+	{822, 844, 831, 806},
+	{823, 926, 926, 807},
+	{824, 828, 828, 808},
+	{825, 829, 829, 809},
+	{826, 901, 901, 810},
+	{827, 902, 902, 811},
+	{828, 903, 903, 812},
+	{829, 904, 904, 813},
+	{830, 905, 905, 814},
+	{831, 906, 906, 815},
+	{832, 907, 907, 816},
+	{833, 921, 790, 817},
+	{834, 922, 791, 818},
+	{843, 893, 921, 819},
+	{835, 894, 922, 820},
+	{836, 895, 847, 821},
+	{837, 896, 848, 822},
+	{838, 897, 893, 823},
+	{839, 898, 894, 824},
+	{840, 899, 895, 825},
+	{841, 900, 896, 826},
+	{842, 796, 897, 827},
+	{844, 797, 898, 828},
+	{845, 798, 899, 829},
+	{846, 945, 900, 830},
+	{847, 946, 796, 831},
+	{848, 786, 797, 832},
+	{849, 767, 798, 833},
+	{850, 910, 945, 834},
+	{851, 911, 946, 835},
+	{852, 912, 767, 836},
+	{853, 913, 910, 837},
+	{854, 914, 911, 838},
+	{855, 915, 912, 839},
+	{856, 916, 913, 840},
+	{857, 917, 914, 841},
+	{858, 918, 915, 842},
+	{867, 763, 916, 843},
+	{868, 803, 917, 844},
+	{859, 812, 918, 845},
+	{860, 813, 763, 846},
+	{861, 804, 756, 847},
+	{862, 805, 757, 848},
+	{863, 806, 773, 849},
+	{864, 807, 774, 850},
+	{865, 808, 927, 851},
+	{866, 809, 858, 852},
+	{869, 810, 867, 853},
+	{870, 811, 868, 854},
+	{871, 756, 859, 855},
+	{872, 757, 860, 856},
+	{873, 773, 861, 857},
+	{874, 774, 862, 858},
+	{875, 927, 876, 859},
+	{876, 789, 864, 860},
+	{877, 802, 865, 861},
+	{878, 960, 866, 862},
+	{879, 961, 789, 863},
+	{880, 800, 802, 864},
+	{881, 801, 800, 865},
+	{882, 919, 801, 866},
+	{883, 931, 919, 867},
+	{884, 932, 770, 868},
+	{885, 770, 771, 869},
+	{886, 771, 772, 870},
+	{887, 772, 931, 871},
+	{888, 878, 932, 872},
+	{889, 920, 878, 873},
+	{890, 933, 920, 874},
+	{891, 934, 786, 875},
+	{892, 923, 933, 876},
+	{893, 924, 934, 877},
+	{894, 925, 923, 878},
+	{895, 820, 924, 879},
+	{896, 821, 925, 880},
+	{897, 822, 820, 881},
+	{898, 823, 821, 882},
+	{899, 824, 822, 883},
+	{900, 825, 823, 884},
+	{901, 826, 824, 885},
+	{902, 827, 825, 886},
+	{903, 764, 826, 887},
+	{904, 909, 827, 888},
+	{905, 888, 844, 889},
+	{906, 889, 764, 890},
+	{907, 793, 909, 891},
+	{908, 775, 888, 892},
+	{909, 776, 889, 893},
+	{910, 777, 793, 894},
+	{911, 887, 775, 895},
+	{912, 858, 776, 896},
+	{913, 867, 777, 897},
+	{914, 868, 887, 898},
+	{915, 859, 908, 899},
+	{916, 860, 877, 900},
+	{917, 861, 947, 901},
+	{918, 862, 948, 902},
+	{919, 863, 758, 903},
+	{920, 864, 759, 904},
+	{921, 865, 778, 905},
+	{922, 866, 779, 906},
+	{923, 908, 814, 907},
+	{924, 877, 815, 908},
+	{925, 778, 816, 909},
+	{926, 779, 783, 910},
+	{927, 814, 784, 911},
+	{928, 815, 935, 912},
+	{929, 816, 944, 913},
+	{930, 783, 936, 914},
+	{931, 784, 937, 915},
+	{932, 935, 938, 916},
+	{933, 944, 939, 917},
+	{934, 936, 940, 918},
+	{935, 937, 941, 919},
+	{944, 938, 942, 920},
+	{936, 939, 943, 921},
+	{937, 940, 785, 922},
+	{938, 941, 760, 923},
+	{939, 942, 960, 924},
+	{940, 943, 961, 925},
+	{941, 785, 879, 926},
+	{942, 879, 880, 927},
+	{943, 880, 881, 928},
+	{945, 881, 882, 929},
+	{946, 882, 883, 930},
+	{947, 883, 884, 931},
+	{948, 884, 949, 932},
+	{949, 947, 958, 933},
+	{958, 948, 959, 934},
+	{959, 949, 950, 935},
+	{950, 958, 951, 936},
+	{951, 959, 952, 937},
+	{952, 950, 953, 938},
+	{953, 951, 954, 939},
+	{954, 952, 955, 940},
+	{955, 953, 956, 941},
+	{956, 954, 957, 942},
+	{957, 955, 832, 943},
+	{960, 956, 833, 944},
+	{961, 957, 863, 945},
+	{962, 962, 962, 946},
+	{963, 963, 963, 947},
+	{964, 964, 964, 948},
+	{965, 965, 965, 949},
+	{966, 966, 966, 950},
+	{967, 967, 967, 951},
+	{968, 968, 968, 952},
+	{969, 969, 969, 953},
+	{970, 970, 970, 954},
+	{971, 971, 971, 955},
+	{972, 972, 972, 956},
+	{973, 973, 973, 957},
+	{974, 974, 974, 958},
+	{975, 975, 975, 959},
+	{976, 976, 976, 960},
+	{977, 977, 977, 961},
+	{978, 978, 979, 980},
+	{979, 979, 978, 981},
+	{980, 980, 980, 982},
+	{981, 981, 981, 983},
+	{982, 982, 982, 984},
+	{983, 983, 983, 985},
+	{984, 984, 984, 986},
+	{985, 985, 985, 987},
+	{986, 986, 986, 988},
+	{987, 987, 987, 989},
+	{988, 988, 988, 990},
+	{989, 989, 989, 991},
+	{990, 990, 990, 992},
+	{991, 991, 991, 993},
+	{992, 992, 992, 994},
+	{993, 993, 993, 995},
+	{994, 994, 994, 996},
+	{995, 995, 995, 997},
+	{996, 996, 996, 998},
+	{997, 997, 997, 999},
+	{998, 998, 998, 1000},
+	{999, 999, 999, 1001},
+	{1000, 1000, 1000, 978},
+	{1001, 1001, 1001, 979},
+	{1002, 1002, 1002, 1002},
+	{1003, 1003, 1003, 1003},
+	{1004, 1004, 1004, 1004},
+	{1005, 1005, 1005, 1005},
+	{-1, -1, -1, -1}
+};
+
 const char* const rtp_table_2k3[][8] = {
 	{"backdrop", "お墓", "graveyard", "graveyard", "grave", "grave", "바닥", "墳場"},
 	{"backdrop", "お寺", "temple1", "shrine", "temple", "temple", "절", "寺廟"},
@@ -1799,4 +2809,684 @@ const int rtp_table_2k3_categories_idx[16] = {
 	676
 };
 
+const int16_t rtp_table_2k3_sorted[][7] = {
+	{0, 32, 32, 19, 19, 31, 0},
+	{1, 31, 27, 31, 31, 12, 24},
+	{2, 21, 31, 21, 15, 28, 8},
+	{3, 15, 21, 15, 28, 15, 1},
+	{4, 19, 15, 2, 32, 2, 9},
+	{5, 22, 17, 12, 22, 3, 10},
+	{6, 2, 19, 28, 2, 4, 11},
+	{7, 3, 22, 24, 3, 5, 13},
+	{8, 4, 2, 32, 4, 6, 14},
+	{9, 5, 3, 22, 5, 7, 15},
+	{10, 6, 4, 13, 6, 29, 16},
+	{11, 7, 5, 14, 7, 16, 22},
+	{12, 13, 6, 26, 24, 18, 17},
+	{13, 14, 7, 0, 13, 0, 18},
+	{14, 26, 13, 4, 14, 10, 21},
+	{15, 0, 14, 17, 26, 21, 31},
+	{16, 17, 12, 30, 0, 22, 19},
+	{17, 9, 0, 6, 9, 9, 20},
+	{18, 12, 9, 3, 12, 25, 23},
+	{19, 29, 18, 9, 25, 33, 32},
+	{20, 10, 26, 29, 16, 13, 12},
+	{21, 11, 29, 10, 29, 14, 25},
+	{22, 30, 10, 27, 10, 23, 26},
+	{23, 18, 23, 11, 27, 17, 27},
+	{24, 25, 30, 23, 30, 19, 28},
+	{25, 24, 25, 18, 23, 8, 2},
+	{26, 33, 1, 25, 21, 30, 3},
+	{27, 20, 24, 33, 18, 20, 4},
+	{28, 16, 33, 8, 33, 1, 5},
+	{29, 1, 8, 20, 8, 26, 6},
+	{30, 23, 20, 5, 20, 32, 7},
+	{31, 28, 16, 16, 1, 11, 29},
+	{32, 8, 28, 1, 11, 24, 30},
+	{33, 27, 11, 7, 17, 27, 33},
+	{34, 41, 41, 41, 41, 40, 38},
+	{35, 46, 68, 55, 34, 34, 34},
+	{36, 36, 71, 44, 35, 35, 35},
+	{37, 45, 46, 46, 46, 39, 39},
+	{38, 44, 72, 36, 36, 43, 40},
+	{39, 37, 36, 53, 44, 46, 41},
+	{40, 53, 61, 39, 37, 59, 42},
+	{41, 39, 56, 47, 39, 49, 43},
+	{42, 50, 84, 43, 47, 58, 44},
+	{43, 47, 44, 52, 52, 36, 55},
+	{44, 43, 81, 51, 51, 37, 45},
+	{45, 52, 37, 45, 43, 55, 46},
+	{46, 51, 62, 54, 54, 53, 47},
+	{47, 54, 53, 38, 38, 54, 48},
+	{48, 38, 80, 34, 53, 47, 37},
+	{49, 34, 50, 35, 59, 56, 49},
+	{50, 35, 76, 59, 42, 38, 50},
+	{51, 59, 47, 37, 50, 48, 51},
+	{52, 42, 73, 48, 55, 57, 52},
+	{53, 55, 64, 50, 57, 50, 53},
+	{54, 48, 43, 42, 45, 45, 54},
+	{55, 40, 70, 40, 48, 52, 36},
+	{56, 56, 52, 49, 40, 44, 56},
+	{57, 49, 79, 57, 56, 51, 57},
+	{58, 57, 51, 58, 49, 42, 58},
+	{59, 58, 77, 56, 58, 41, 59},
+	{60, 81, 78, 60, 68, 66, 63},
+	{61, 72, 42, 61, 60, 67, 64},
+	{62, 61, 69, 62, 72, 60, 60},
+	{63, 68, 54, 63, 61, 65, 65},
+	{64, 71, 82, 64, 81, 70, 66},
+	{65, 62, 39, 65, 62, 72, 67},
+	{66, 63, 65, 66, 65, 87, 68},
+	{67, 80, 63, 67, 73, 75, 69},
+	{68, 73, 38, 68, 64, 86, 70},
+	{69, 64, 34, 69, 79, 61, 83},
+	{70, 70, 35, 70, 77, 63, 71},
+	{71, 79, 60, 71, 78, 83, 72},
+	{72, 77, 59, 72, 70, 80, 73},
+	{73, 78, 87, 73, 82, 82, 74},
+	{74, 82, 55, 74, 80, 73, 62},
+	{75, 65, 83, 75, 87, 84, 75},
+	{76, 60, 48, 76, 69, 74, 76},
+	{77, 87, 74, 77, 76, 85, 77},
+	{78, 69, 45, 78, 83, 76, 78},
+	{79, 83, 40, 79, 63, 71, 79},
+	{80, 74, 66, 80, 85, 79, 80},
+	{81, 66, 67, 81, 71, 64, 82},
+	{82, 67, 49, 82, 74, 62, 81},
+	{83, 84, 75, 83, 66, 81, 61},
+	{84, 76, 57, 84, 67, 77, 84},
+	{85, 75, 85, 85, 84, 78, 85},
+	{86, 85, 58, 86, 75, 69, 86},
+	{87, 86, 86, 87, 86, 68, 87},
+	{88, 146, 146, 114, 146, 146, 92},
+	{89, 147, 147, 115, 147, 147, 93},
+	{90, 94, 92, 94, 94, 124, 94},
+	{91, 95, 93, 95, 95, 125, 95},
+	{92, 92, 94, 136, 92, 126, 98},
+	{93, 93, 95, 137, 93, 127, 99},
+	{94, 142, 88, 92, 90, 132, 100},
+	{95, 143, 89, 93, 91, 133, 101},
+	{96, 88, 90, 106, 88, 134, 102},
+	{97, 89, 91, 107, 89, 135, 103},
+	{98, 124, 102, 120, 126, 136, 104},
+	{99, 125, 103, 121, 127, 137, 105},
+	{100, 102, 104, 140, 124, 138, 106},
+	{101, 103, 105, 141, 125, 139, 107},
+	{102, 148, 148, 96, 104, 140, 108},
+	{103, 149, 149, 97, 105, 141, 109},
+	{104, 98, 150, 116, 102, 116, 110},
+	{105, 99, 151, 117, 103, 117, 111},
+	{106, 116, 132, 130, 150, 118, 112},
+	{107, 117, 133, 131, 151, 119, 113},
+	{108, 128, 134, 110, 148, 142, 114},
+	{109, 129, 135, 111, 149, 143, 115},
+	{110, 120, 136, 104, 132, 144, 88},
+	{111, 121, 137, 105, 133, 145, 89},
+	{112, 144, 138, 132, 134, 148, 90},
+	{113, 145, 139, 133, 135, 149, 91},
+	{114, 90, 140, 108, 136, 150, 116},
+	{115, 91, 141, 109, 137, 151, 117},
+	{116, 126, 124, 146, 138, 96, 118},
+	{117, 127, 125, 147, 139, 97, 119},
+	{118, 104, 126, 98, 140, 98, 120},
+	{119, 105, 127, 99, 141, 99, 121},
+	{120, 150, 116, 148, 100, 100, 122},
+	{121, 151, 117, 149, 101, 101, 123},
+	{122, 100, 118, 134, 98, 90, 124},
+	{123, 101, 119, 135, 99, 91, 125},
+	{124, 118, 128, 102, 118, 88, 126},
+	{125, 119, 129, 103, 119, 89, 127},
+	{126, 130, 130, 112, 116, 106, 96},
+	{127, 131, 131, 113, 117, 107, 97},
+	{128, 122, 100, 142, 131, 108, 128},
+	{129, 123, 101, 143, 130, 109, 129},
+	{130, 132, 98, 124, 128, 110, 130},
+	{131, 133, 99, 125, 129, 111, 131},
+	{132, 134, 96, 122, 96, 112, 132},
+	{133, 135, 97, 123, 97, 113, 133},
+	{134, 136, 120, 126, 122, 114, 134},
+	{135, 137, 121, 127, 123, 115, 135},
+	{136, 138, 122, 128, 120, 102, 136},
+	{137, 139, 123, 129, 121, 103, 137},
+	{138, 140, 142, 150, 144, 104, 138},
+	{139, 141, 143, 151, 145, 105, 139},
+	{140, 96, 144, 138, 142, 120, 140},
+	{141, 97, 145, 139, 143, 121, 141},
+	{142, 106, 106, 100, 106, 122, 142},
+	{143, 107, 107, 101, 107, 123, 143},
+	{144, 108, 108, 90, 108, 92, 144},
+	{145, 109, 109, 91, 109, 93, 145},
+	{146, 110, 110, 88, 110, 94, 146},
+	{147, 111, 111, 89, 111, 95, 147},
+	{148, 112, 112, 144, 112, 130, 148},
+	{149, 113, 113, 145, 113, 131, 149},
+	{150, 114, 114, 118, 114, 128, 150},
+	{151, 115, 115, 119, 115, 129, 151},
+	{152, 152, 152, 152, 152, 152, 152},
+	{153, 162, 167, 167, 167, 167, 157},
+	{154, 163, 157, 162, 157, 155, 158},
+	{155, 164, 158, 163, 158, 156, 159},
+	{156, 165, 159, 164, 159, 153, 160},
+	{157, 167, 160, 165, 160, 154, 161},
+	{158, 155, 161, 155, 161, 157, 162},
+	{159, 156, 162, 156, 155, 158, 163},
+	{160, 153, 163, 153, 156, 159, 164},
+	{161, 154, 164, 154, 153, 160, 165},
+	{162, 157, 165, 157, 154, 161, 166},
+	{163, 158, 155, 158, 162, 162, 167},
+	{164, 159, 156, 159, 163, 163, 155},
+	{165, 160, 153, 160, 164, 164, 156},
+	{166, 161, 154, 161, 165, 165, 153},
+	{167, 166, 166, 166, 166, 166, 154},
+	{168, 168, 169, 168, 171, 170, 169},
+	{169, 171, 168, 169, 170, 169, 170},
+	{170, 169, 170, 172, 172, 168, 171},
+	{171, 172, 172, 171, 168, 172, 172},
+	{172, 170, 171, 170, 169, 171, 168},
+	{173, 176, 174, 176, 174, 173, 174},
+	{174, 177, 175, 177, 175, 174, 175},
+	{175, 173, 176, 173, 173, 175, 176},
+	{176, 174, 177, 174, 176, 176, 177},
+	{177, 175, 173, 175, 177, 177, 173},
+	{178, 178, 178, 178, 178, 178, 178},
+	{179, 179, 179, 179, 179, 179, 179},
+	{181, 180, 183, 258, 180, 194, 184},
+	{182, 183, 182, 189, 183, 199, 287},
+	{183, 182, 180, 253, 182, 207, 260},
+	{184, 181, 181, 256, 236, 212, 185},
+	{180, 257, 257, 264, 190, 216, 202},
+	{185, 255, 255, 247, 253, 213, 193},
+	{186, 256, 256, 286, 256, 214, 211},
+	{188, 263, 263, 221, 264, 205, 220},
+	{189, 253, 253, 229, 263, 287, 198},
+	{193, 259, 259, 223, 208, 201, 196},
+	{190, 290, 289, 211, 294, 204, 234},
+	{191, 209, 294, 210, 212, 293, 274},
+	{192, 195, 209, 200, 195, 252, 200},
+	{197, 196, 203, 203, 196, 251, 188},
+	{198, 198, 195, 269, 237, 241, 187},
+	{195, 211, 198, 183, 211, 240, 210},
+	{196, 237, 211, 265, 210, 245, 217},
+	{199, 210, 237, 198, 200, 244, 244},
+	{194, 200, 210, 218, 215, 292, 262},
+	{200, 215, 200, 230, 203, 247, 276},
+	{203, 203, 215, 192, 206, 248, 259},
+	{202, 206, 196, 219, 245, 275, 264},
+	{206, 218, 206, 291, 219, 274, 229},
+	{204, 240, 218, 184, 240, 282, 192},
+	{205, 241, 240, 249, 241, 281, 279},
+	{201, 245, 241, 257, 198, 280, 189},
+	{209, 247, 207, 248, 188, 276, 258},
+	{208, 248, 245, 185, 247, 277, 216},
+	{210, 189, 247, 209, 248, 278, 186},
+	{211, 262, 248, 207, 255, 279, 285},
+	{207, 194, 185, 226, 189, 266, 250},
+	{215, 199, 189, 293, 207, 265, 223},
+	{217, 207, 262, 186, 226, 291, 263},
+	{216, 289, 194, 240, 282, 267, 182},
+	{212, 213, 199, 235, 287, 272, 203},
+	{213, 201, 213, 199, 246, 270, 238},
+	{214, 223, 201, 208, 194, 269, 257},
+	{218, 216, 223, 194, 199, 271, 225},
+	{219, 214, 216, 214, 213, 268, 233},
+	{220, 212, 214, 204, 201, 255, 282},
+	{221, 205, 212, 254, 218, 257, 292},
+	{225, 204, 205, 255, 223, 256, 245},
+	{222, 254, 204, 245, 293, 263, 212},
+	{226, 264, 254, 272, 214, 290, 275},
+	{223, 291, 264, 212, 227, 187, 199},
+	{224, 260, 260, 263, 275, 253, 236},
+	{227, 185, 186, 266, 204, 259, 219},
+	{228, 186, 224, 241, 254, 221, 227},
+	{229, 224, 197, 231, 291, 218, 232},
+	{230, 197, 293, 188, 260, 219, 241},
+	{231, 293, 217, 276, 185, 220, 268},
+	{232, 217, 202, 216, 216, 222, 288},
+	{233, 202, 275, 278, 224, 236, 272},
+	{234, 287, 276, 294, 205, 235, 249},
+	{235, 274, 279, 225, 209, 237, 281},
+	{236, 275, 280, 287, 252, 225, 251},
+	{237, 276, 277, 238, 217, 238, 239},
+	{238, 279, 278, 233, 276, 228, 205},
+	{239, 280, 267, 180, 279, 229, 197},
+	{242, 277, 265, 267, 280, 227, 242},
+	{243, 278, 266, 244, 186, 230, 221},
+	{240, 267, 272, 260, 277, 233, 224},
+	{241, 265, 269, 227, 257, 231, 206},
+	{244, 266, 271, 275, 278, 232, 253},
+	{245, 272, 270, 270, 233, 234, 283},
+	{249, 269, 268, 277, 267, 226, 243},
+	{250, 271, 251, 197, 272, 182, 218},
+	{246, 270, 252, 280, 235, 180, 273},
+	{247, 268, 291, 237, 220, 181, 191},
+	{248, 251, 287, 252, 271, 184, 289},
+	{251, 252, 193, 268, 270, 183, 290},
+	{252, 193, 192, 196, 265, 189, 237},
+	{254, 192, 190, 251, 269, 190, 207},
+	{255, 190, 292, 193, 289, 192, 183},
+	{256, 292, 191, 292, 181, 191, 194},
+	{257, 191, 188, 271, 268, 193, 269},
+	{253, 188, 258, 250, 274, 286, 195},
+	{258, 258, 261, 281, 251, 285, 208},
+	{260, 261, 208, 261, 193, 188, 280},
+	{259, 208, 274, 191, 192, 283, 204},
+	{261, 282, 288, 239, 292, 284, 265},
+	{262, 294, 282, 290, 191, 273, 230},
+	{263, 220, 220, 279, 258, 185, 255},
+	{264, 221, 221, 190, 261, 186, 277},
+	{265, 219, 219, 274, 184, 223, 278},
+	{266, 229, 229, 224, 266, 224, 256},
+	{267, 227, 227, 262, 197, 239, 266},
+	{268, 236, 236, 205, 288, 288, 284},
+	{269, 225, 225, 215, 221, 294, 246},
+	{270, 222, 222, 195, 229, 196, 271},
+	{271, 235, 235, 202, 202, 195, 252},
+	{272, 228, 228, 285, 225, 198, 209},
+	{273, 234, 234, 236, 222, 197, 235},
+	{274, 230, 230, 222, 228, 209, 270},
+	{275, 238, 238, 282, 234, 208, 267},
+	{277, 233, 233, 228, 230, 211, 180},
+	{278, 232, 232, 234, 281, 210, 181},
+	{279, 231, 243, 182, 232, 217, 215},
+	{280, 288, 231, 232, 243, 215, 231},
+	{276, 226, 226, 243, 231, 206, 294},
+	{281, 243, 244, 242, 244, 202, 226},
+	{282, 244, 242, 246, 242, 203, 286},
+	{285, 242, 246, 284, 249, 200, 190},
+	{286, 246, 249, 220, 250, 243, 201},
+	{283, 249, 250, 289, 273, 242, 291},
+	{284, 250, 184, 273, 187, 246, 228},
+	{187, 184, 273, 288, 283, 249, 214},
+	{287, 273, 187, 187, 290, 250, 213},
+	{288, 187, 283, 181, 238, 258, 222},
+	{289, 283, 290, 283, 262, 262, 254},
+	{290, 285, 285, 213, 284, 261, 261},
+	{291, 284, 284, 217, 286, 254, 293},
+	{292, 281, 281, 206, 259, 289, 240},
+	{293, 286, 286, 259, 285, 264, 247},
+	{294, 239, 239, 201, 239, 260, 248},
+	{295, 303, 303, 316, 324, 337, 302},
+	{296, 305, 310, 329, 318, 338, 299},
+	{297, 341, 305, 304, 329, 329, 303},
+	{298, 321, 403, 319, 333, 313, 328},
+	{299, 296, 297, 320, 342, 305, 304},
+	{300, 311, 309, 341, 334, 322, 336},
+	{301, 322, 338, 322, 296, 326, 305},
+	{302, 337, 421, 331, 322, 327, 306},
+	{303, 297, 422, 321, 297, 339, 307},
+	{304, 318, 423, 328, 331, 335, 308},
+	{305, 298, 427, 315, 302, 308, 309},
+	{306, 324, 440, 317, 316, 310, 311},
+	{307, 339, 441, 310, 312, 311, 312},
+	{308, 330, 442, 303, 326, 309, 313},
+	{309, 307, 392, 323, 321, 301, 314},
+	{310, 302, 393, 306, 307, 307, 315},
+	{311, 308, 394, 332, 328, 330, 316},
+	{312, 316, 395, 336, 309, 325, 317},
+	{313, 340, 298, 326, 311, 336, 334},
+	{314, 312, 342, 309, 313, 341, 300},
+	{315, 326, 296, 324, 327, 298, 318},
+	{316, 329, 405, 305, 314, 315, 319},
+	{317, 309, 406, 311, 301, 318, 320},
+	{318, 295, 407, 295, 317, 299, 321},
+	{319, 304, 322, 340, 308, 320, 322},
+	{320, 328, 426, 298, 305, 321, 323},
+	{321, 319, 425, 299, 339, 324, 324},
+	{322, 314, 445, 313, 300, 323, 325},
+	{323, 313, 332, 339, 298, 328, 326},
+	{324, 327, 382, 314, 340, 303, 301},
+	{325, 301, 383, 297, 299, 334, 327},
+	{326, 332, 384, 337, 320, 331, 329},
+	{327, 331, 385, 301, 295, 312, 295},
+	{328, 300, 386, 296, 332, 304, 330},
+	{329, 336, 316, 327, 335, 319, 337},
+	{330, 342, 371, 308, 319, 317, 298},
+	{331, 299, 372, 330, 336, 340, 332},
+	{332, 320, 373, 302, 338, 302, 331},
+	{333, 334, 336, 334, 337, 314, 333},
+	{334, 306, 319, 335, 304, 342, 310},
+	{335, 323, 324, 318, 306, 316, 297},
+	{336, 338, 444, 338, 325, 306, 335},
+	{337, 335, 424, 342, 330, 332, 341},
+	{338, 315, 312, 333, 303, 333, 338},
+	{339, 325, 411, 300, 323, 296, 339},
+	{340, 333, 412, 343, 315, 297, 296},
+	{341, 310, 347, 325, 341, 300, 340},
+	{342, 317, 348, 312, 310, 295, 342},
+	{343, 403, 349, 307, 343, 343, 392},
+	{344, 421, 350, 365, 355, 345, 393},
+	{345, 422, 351, 361, 356, 346, 394},
+	{346, 423, 352, 362, 357, 360, 395},
+	{347, 444, 326, 363, 358, 353, 343},
+	{348, 392, 388, 364, 359, 354, 353},
+	{349, 393, 389, 368, 347, 344, 354},
+	{350, 394, 390, 366, 348, 359, 347},
+	{351, 395, 391, 370, 349, 355, 348},
+	{352, 405, 301, 367, 350, 356, 349},
+	{353, 406, 318, 369, 351, 357, 350},
+	{354, 407, 307, 344, 352, 358, 351},
+	{355, 426, 377, 345, 345, 347, 352},
+	{356, 425, 378, 346, 346, 348, 355},
+	{357, 445, 379, 347, 353, 349, 356},
+	{358, 382, 380, 348, 354, 350, 357},
+	{359, 383, 381, 349, 344, 351, 358},
+	{360, 384, 341, 350, 360, 352, 344},
+	{361, 385, 311, 351, 361, 364, 359},
+	{362, 386, 330, 352, 365, 365, 360},
+	{363, 371, 401, 353, 363, 361, 345},
+	{364, 372, 402, 354, 362, 362, 346},
+	{365, 373, 343, 355, 364, 363, 362},
+	{366, 424, 328, 356, 368, 369, 361},
+	{367, 411, 353, 357, 366, 370, 363},
+	{368, 412, 354, 358, 367, 368, 364},
+	{369, 388, 334, 359, 370, 366, 365},
+	{370, 389, 321, 360, 369, 367, 366},
+	{371, 390, 344, 371, 371, 377, 367},
+	{372, 391, 302, 372, 372, 378, 369},
+	{373, 377, 306, 373, 373, 379, 368},
+	{374, 378, 313, 374, 374, 380, 370},
+	{375, 379, 419, 375, 375, 381, 396},
+	{376, 380, 314, 376, 376, 426, 397},
+	{377, 381, 327, 377, 377, 371, 398},
+	{378, 401, 317, 378, 378, 372, 399},
+	{379, 402, 339, 379, 379, 373, 400},
+	{380, 387, 345, 380, 380, 431, 401},
+	{381, 343, 346, 381, 381, 403, 402},
+	{382, 359, 308, 382, 382, 445, 403},
+	{383, 355, 315, 383, 383, 439, 404},
+	{384, 356, 436, 384, 384, 427, 387},
+	{385, 357, 437, 385, 385, 433, 388},
+	{386, 358, 438, 386, 386, 434, 389},
+	{387, 347, 374, 387, 387, 435, 390},
+	{388, 348, 375, 388, 388, 440, 391},
+	{389, 349, 376, 389, 389, 441, 405},
+	{390, 350, 443, 390, 390, 442, 406},
+	{391, 351, 300, 391, 391, 392, 407},
+	{392, 352, 399, 392, 392, 393, 408},
+	{393, 353, 400, 393, 393, 394, 409},
+	{394, 354, 360, 394, 394, 395, 410},
+	{395, 344, 331, 395, 395, 405, 411},
+	{396, 345, 340, 396, 396, 406, 412},
+	{397, 346, 420, 397, 397, 407, 413},
+	{398, 360, 320, 398, 398, 420, 414},
+	{399, 432, 361, 399, 399, 404, 415},
+	{400, 427, 365, 400, 400, 443, 416},
+	{401, 436, 368, 401, 401, 436, 417},
+	{402, 437, 363, 402, 402, 437, 418},
+	{403, 438, 364, 403, 403, 438, 419},
+	{404, 374, 362, 404, 404, 444, 420},
+	{405, 375, 369, 405, 405, 374, 421},
+	{406, 376, 366, 406, 406, 375, 422},
+	{407, 399, 370, 407, 407, 376, 423},
+	{408, 400, 367, 408, 408, 411, 424},
+	{409, 413, 416, 409, 409, 412, 425},
+	{410, 414, 417, 410, 410, 401, 426},
+	{411, 415, 418, 411, 411, 402, 427},
+	{412, 361, 329, 412, 412, 399, 432},
+	{413, 365, 299, 413, 413, 400, 428},
+	{414, 363, 413, 414, 414, 421, 429},
+	{415, 362, 414, 415, 415, 422, 430},
+	{416, 364, 415, 416, 416, 423, 431},
+	{417, 368, 295, 417, 417, 416, 436},
+	{418, 439, 325, 418, 418, 417, 437},
+	{419, 367, 432, 419, 419, 418, 438},
+	{420, 366, 404, 420, 420, 382, 439},
+	{421, 370, 359, 421, 421, 383, 371},
+	{422, 369, 335, 422, 422, 384, 372},
+	{423, 440, 431, 423, 423, 385, 373},
+	{424, 441, 387, 424, 424, 386, 440},
+	{425, 442, 408, 425, 425, 396, 441},
+	{426, 416, 409, 426, 426, 397, 442},
+	{427, 417, 410, 427, 427, 398, 433},
+	{428, 418, 337, 428, 428, 428, 434},
+	{429, 420, 433, 429, 429, 429, 435},
+	{430, 431, 434, 430, 430, 430, 443},
+	{431, 408, 435, 431, 431, 424, 382},
+	{432, 409, 439, 432, 432, 408, 383},
+	{433, 410, 304, 433, 433, 409, 384},
+	{434, 433, 396, 434, 434, 410, 385},
+	{435, 434, 397, 435, 435, 425, 386},
+	{436, 435, 398, 436, 436, 413, 377},
+	{437, 443, 355, 437, 437, 414, 378},
+	{438, 396, 356, 438, 438, 415, 379},
+	{439, 397, 357, 439, 439, 387, 374},
+	{440, 398, 358, 440, 440, 388, 375},
+	{441, 404, 428, 441, 441, 389, 376},
+	{442, 428, 429, 442, 442, 390, 380},
+	{443, 429, 430, 443, 443, 391, 381},
+	{444, 430, 323, 444, 444, 419, 445},
+	{445, 419, 333, 445, 445, 432, 444},
+	{446, 452, 448, 446, 448, 450, 446},
+	{447, 448, 449, 447, 449, 451, 447},
+	{448, 449, 446, 448, 457, 448, 450},
+	{449, 456, 447, 449, 458, 449, 451},
+	{450, 450, 450, 452, 446, 446, 457},
+	{451, 451, 451, 457, 447, 447, 458},
+	{452, 453, 453, 458, 450, 452, 452},
+	{453, 454, 454, 450, 451, 456, 453},
+	{454, 455, 455, 451, 453, 457, 454},
+	{455, 457, 457, 453, 454, 458, 455},
+	{456, 458, 458, 454, 455, 453, 456},
+	{457, 446, 452, 455, 452, 454, 448},
+	{458, 447, 456, 456, 456, 455, 449},
+	{461, 520, 520, 579, 520, 470, 463},
+	{462, 521, 521, 459, 521, 464, 483},
+	{467, 559, 559, 460, 461, 517, 486},
+	{473, 560, 560, 461, 462, 518, 487},
+	{474, 495, 495, 462, 559, 519, 484},
+	{475, 535, 550, 463, 560, 588, 485},
+	{489, 536, 551, 464, 495, 589, 506},
+	{490, 631, 522, 465, 550, 491, 515},
+	{493, 522, 638, 466, 551, 559, 516},
+	{494, 573, 639, 467, 631, 560, 507},
+	{496, 552, 640, 468, 522, 623, 508},
+	{459, 553, 641, 469, 552, 506, 509},
+	{460, 554, 642, 470, 553, 515, 510},
+	{463, 555, 643, 471, 554, 516, 511},
+	{464, 556, 644, 472, 555, 507, 512},
+	{465, 557, 645, 473, 556, 508, 513},
+	{466, 558, 646, 474, 557, 509, 514},
+	{468, 548, 647, 475, 558, 510, 489},
+	{469, 549, 548, 476, 548, 511, 517},
+	{470, 502, 549, 477, 549, 512, 518},
+	{471, 463, 502, 478, 502, 513, 519},
+	{472, 493, 535, 479, 497, 514, 471},
+	{478, 494, 536, 480, 498, 580, 472},
+	{479, 497, 497, 481, 471, 489, 467},
+	{480, 498, 498, 482, 472, 492, 520},
+	{476, 471, 471, 483, 595, 483, 521},
+	{477, 472, 472, 484, 491, 632, 522},
+	{481, 491, 491, 485, 490, 633, 523},
+	{482, 490, 490, 486, 572, 547, 524},
+	{483, 461, 588, 487, 632, 490, 525},
+	{484, 462, 589, 488, 633, 537, 526},
+	{485, 572, 572, 489, 465, 546, 527},
+	{486, 632, 632, 490, 468, 538, 528},
+	{487, 633, 633, 491, 469, 539, 529},
+	{488, 593, 595, 492, 561, 540, 530},
+	{491, 594, 465, 493, 562, 541, 533},
+	{492, 550, 468, 494, 563, 542, 534},
+	{495, 551, 469, 495, 564, 543, 535},
+	{499, 595, 484, 496, 565, 544, 536},
+	{500, 465, 485, 497, 566, 545, 537},
+	{501, 468, 574, 498, 567, 484, 546},
+	{497, 469, 575, 499, 568, 485, 538},
+	{498, 484, 576, 500, 569, 629, 539},
+	{502, 485, 577, 501, 570, 581, 540},
+	{503, 574, 578, 502, 571, 624, 541},
+	{504, 575, 579, 503, 484, 625, 542},
+	{505, 576, 483, 504, 485, 663, 543},
+	{506, 577, 464, 505, 573, 664, 544},
+	{515, 578, 537, 506, 574, 473, 545},
+	{516, 579, 538, 507, 575, 474, 548},
+	{507, 483, 539, 508, 576, 475, 549},
+	{508, 588, 540, 509, 577, 612, 626},
+	{509, 589, 541, 510, 578, 503, 627},
+	{510, 464, 542, 511, 579, 504, 628},
+	{511, 537, 543, 512, 588, 582, 503},
+	{512, 546, 544, 513, 589, 583, 504},
+	{513, 538, 545, 514, 593, 584, 550},
+	{514, 539, 546, 515, 594, 585, 551},
+	{517, 540, 547, 516, 464, 586, 552},
+	{518, 541, 531, 517, 483, 587, 553},
+	{519, 542, 532, 518, 537, 522, 554},
+	{520, 543, 604, 519, 546, 591, 555},
+	{521, 544, 605, 520, 538, 592, 556},
+	{522, 545, 606, 521, 539, 652, 557},
+	{523, 533, 607, 522, 540, 661, 558},
+	{524, 534, 608, 523, 541, 662, 547},
+	{525, 547, 609, 524, 542, 653, 559},
+	{526, 629, 610, 525, 543, 654, 560},
+	{527, 531, 493, 526, 544, 655, 492},
+	{528, 532, 494, 527, 545, 656, 561},
+	{529, 604, 624, 528, 533, 657, 562},
+	{530, 605, 625, 529, 534, 658, 563},
+	{531, 606, 596, 530, 493, 659, 564},
+	{532, 607, 597, 531, 494, 660, 565},
+	{533, 608, 598, 532, 629, 466, 566},
+	{534, 609, 599, 533, 531, 495, 567},
+	{535, 610, 600, 534, 532, 497, 568},
+	{536, 624, 601, 535, 604, 498, 569},
+	{537, 625, 602, 536, 605, 561, 570},
+	{546, 596, 603, 537, 606, 562, 571},
+	{538, 597, 499, 538, 607, 563, 572},
+	{539, 598, 500, 539, 608, 564, 574},
+	{540, 599, 501, 540, 609, 565, 575},
+	{541, 600, 629, 541, 610, 566, 576},
+	{542, 601, 648, 542, 624, 567, 577},
+	{543, 602, 649, 543, 625, 568, 578},
+	{544, 603, 622, 544, 596, 569, 579},
+	{545, 499, 489, 545, 597, 570, 580},
+	{547, 500, 631, 546, 598, 571, 581},
+	{548, 501, 523, 547, 599, 535, 502},
+	{549, 648, 524, 548, 600, 536, 582},
+	{550, 649, 525, 549, 601, 636, 583},
+	{551, 489, 526, 550, 602, 637, 584},
+	{552, 470, 527, 551, 603, 505, 585},
+	{553, 613, 528, 552, 499, 465, 586},
+	{554, 614, 529, 553, 500, 593, 587},
+	{555, 615, 530, 554, 501, 594, 588},
+	{556, 616, 613, 555, 648, 626, 589},
+	{557, 617, 614, 556, 649, 627, 497},
+	{558, 618, 615, 557, 489, 628, 498},
+	{559, 619, 616, 558, 470, 478, 590},
+	{560, 620, 617, 559, 613, 479, 612},
+	{561, 621, 618, 560, 614, 480, 591},
+	{562, 466, 619, 561, 615, 611, 592},
+	{563, 506, 620, 562, 616, 481, 593},
+	{564, 515, 621, 563, 617, 482, 594},
+	{565, 516, 466, 564, 618, 572, 595},
+	{566, 507, 506, 565, 619, 613, 468},
+	{567, 508, 515, 566, 620, 614, 469},
+	{568, 509, 516, 567, 621, 615, 596},
+	{569, 510, 507, 568, 466, 616, 597},
+	{570, 511, 508, 569, 506, 617, 598},
+	{571, 512, 509, 570, 515, 618, 599},
+	{572, 513, 510, 571, 516, 619, 600},
+	{573, 514, 511, 572, 507, 620, 601},
+	{574, 459, 512, 573, 508, 621, 602},
+	{575, 460, 513, 574, 509, 459, 603},
+	{576, 476, 514, 575, 510, 460, 604},
+	{577, 477, 463, 576, 511, 648, 605},
+	{578, 630, 459, 577, 512, 649, 606},
+	{579, 492, 460, 578, 513, 573, 607},
+	{580, 505, 461, 580, 514, 574, 608},
+	{581, 663, 462, 581, 459, 575, 609},
+	{582, 664, 476, 582, 460, 576, 610},
+	{583, 503, 477, 583, 476, 577, 465},
+	{584, 504, 630, 584, 477, 578, 459},
+	{585, 622, 492, 585, 630, 579, 460},
+	{586, 634, 505, 586, 492, 496, 464},
+	{587, 635, 663, 587, 478, 463, 505},
+	{588, 473, 664, 588, 479, 634, 478},
+	{589, 474, 503, 589, 480, 635, 479},
+	{590, 475, 504, 590, 505, 467, 480},
+	{591, 581, 573, 591, 663, 650, 611},
+	{592, 623, 634, 592, 664, 651, 461},
+	{593, 636, 635, 593, 503, 622, 462},
+	{594, 637, 473, 594, 504, 630, 493},
+	{595, 626, 474, 595, 634, 493, 494},
+	{596, 627, 475, 596, 635, 494, 613},
+	{597, 628, 581, 597, 473, 638, 614},
+	{598, 523, 623, 598, 474, 647, 615},
+	{599, 524, 552, 599, 475, 639, 616},
+	{600, 525, 553, 600, 581, 640, 617},
+	{601, 526, 554, 601, 623, 641, 618},
+	{602, 527, 555, 602, 636, 642, 619},
+	{603, 528, 556, 603, 637, 643, 620},
+	{604, 529, 557, 604, 523, 644, 621},
+	{605, 530, 558, 605, 524, 645, 622},
+	{606, 467, 533, 606, 525, 646, 496},
+	{607, 612, 534, 607, 526, 550, 623},
+	{608, 591, 636, 608, 527, 551, 624},
+	{609, 592, 637, 609, 528, 476, 625},
+	{610, 496, 626, 610, 529, 477, 488},
+	{611, 478, 627, 611, 530, 631, 470},
+	{612, 479, 628, 612, 626, 461, 495},
+	{613, 480, 467, 613, 627, 462, 491},
+	{614, 590, 612, 614, 628, 533, 476},
+	{615, 561, 591, 615, 467, 534, 477},
+	{616, 562, 592, 616, 622, 471, 531},
+	{617, 563, 470, 617, 612, 472, 532},
+	{618, 564, 496, 618, 591, 590, 629},
+	{619, 565, 478, 619, 592, 468, 631},
+	{620, 566, 479, 620, 496, 469, 630},
+	{621, 567, 480, 621, 590, 552, 499},
+	{622, 568, 590, 622, 611, 553, 500},
+	{623, 569, 611, 623, 580, 554, 501},
+	{624, 570, 580, 624, 650, 555, 634},
+	{625, 571, 561, 625, 651, 556, 635},
+	{626, 611, 564, 626, 481, 557, 481},
+	{627, 580, 565, 627, 482, 558, 482},
+	{628, 481, 566, 628, 517, 486, 632},
+	{629, 482, 567, 629, 518, 487, 633},
+	{630, 517, 568, 630, 519, 488, 490},
+	{631, 518, 569, 631, 486, 604, 636},
+	{632, 519, 570, 632, 487, 605, 637},
+	{633, 486, 571, 633, 638, 606, 638},
+	{634, 487, 562, 634, 647, 607, 647},
+	{635, 638, 563, 635, 639, 608, 639},
+	{636, 647, 481, 636, 640, 609, 640},
+	{637, 639, 482, 637, 641, 610, 641},
+	{638, 640, 517, 638, 642, 499, 642},
+	{647, 641, 518, 639, 643, 500, 643},
+	{639, 642, 519, 640, 644, 501, 644},
+	{640, 643, 486, 641, 645, 502, 645},
+	{641, 644, 487, 642, 646, 595, 646},
+	{642, 645, 488, 643, 488, 596, 648},
+	{643, 646, 593, 644, 463, 597, 649},
+	{644, 488, 594, 645, 547, 598, 650},
+	{645, 582, 582, 646, 535, 599, 651},
+	{646, 583, 583, 647, 536, 600, 652},
+	{648, 584, 584, 648, 582, 601, 661},
+	{649, 585, 585, 649, 583, 602, 662},
+	{650, 586, 586, 650, 584, 603, 653},
+	{651, 587, 587, 651, 585, 548, 654},
+	{652, 650, 650, 652, 586, 549, 655},
+	{661, 651, 651, 653, 587, 523, 656},
+	{662, 652, 652, 654, 652, 524, 657},
+	{653, 661, 653, 655, 661, 525, 658},
+	{654, 662, 654, 656, 662, 526, 659},
+	{655, 653, 655, 657, 653, 527, 660},
+	{656, 654, 656, 658, 654, 528, 466},
+	{657, 655, 657, 659, 655, 529, 663},
+	{658, 656, 658, 660, 656, 530, 664},
+	{659, 657, 659, 661, 657, 531, 473},
+	{660, 658, 660, 662, 658, 532, 474},
+	{663, 659, 661, 663, 659, 520, 475},
+	{664, 660, 662, 664, 660, 521, 573},
+	{665, 665, 665, 665, 665, 665, 665},
+	{666, 666, 666, 666, 666, 666, 666},
+	{667, 667, 667, 667, 667, 667, 667},
+	{668, 668, 668, 668, 668, 668, 668},
+	{669, 669, 669, 669, 669, 669, 669},
+	{670, 670, 670, 670, 670, 670, 670},
+	{671, 671, 671, 671, 671, 671, 671},
+	{672, 672, 672, 672, 672, 672, 672},
+	{673, 673, 673, 673, 673, 673, 673},
+	{674, 674, 674, 674, 674, 674, 674},
+	{675, 675, 675, 675, 675, 675, 675},
+	{-1, -1, -1, -1, -1, -1, -1}
+};
+
 }
@@ -0,0 +1,157 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include "save_writer.h"
+#include "filesystem_stream.h"
+#include "output.h"
+#include "system.h"
+#include <lcf/lsd/reader.h>
+
+#ifdef EMSCRIPTEN
+#  include <emscripten.h>
+#endif
+
+#ifdef HAVE_THREADS
+#include <atomic>
+#include <thread>
+#endif
+
+namespace {
+	struct Job {
+		FilesystemView fs;
+		std::string filename;
+		/** File the savegame is written to, replaces filename when it differs */
+		std::string write_filename;
+		std::unique_ptr<lcf::rpg::Save> save;
+		lcf::EngineVersion engine = lcf::EngineVersion::e2k;
+		std::string encoding;
+		Filesystem_Stream::OutputStream os;
+		SaveWriter::Callback on_done;
+		bool success = false;
+	};
+
+	std::unique_ptr<Job> job;
+
+#ifdef HAVE_THREADS
+	std::thread worker;
+	std::atomic<bool> worker_done { false };
+#endif
+
+	/** Serializes the savegame, does not touch the filesystem caches */
+	void Serialize(Job& job) {
+		job.success = lcf::LSD_Reader::Save(job.os, *job.save, job.engine, job.encoding);
+		job.os.flush();
+		job.success = job.success && job.os.good();
+		job.save.reset();
+	}
+
+	void Finish() {
+#ifdef HAVE_THREADS
+		if (worker.joinable()) {
+			worker.join();
+		}
+		worker_done = false;
+#endif
+
+		auto done = std::move(job);
+
+		done->os.Close();
+
+		bool success = done->success;
+		if (done->write_filename != done->filename) {
+			if (success) {
+				success = done->fs.RenameFile(done->write_filename, done->filename);
+			}
+			if (!success) {
+				// Do not leave an incomplete temporary file behind
+				done->fs.RemoveFile(done->write_filename);
+			}
+		}
+		done->fs.ClearCache();
+
+		if (success) {
+			Output::Debug("Saved {}", done->filename);
+		} else {
+			Output::Warning("Không thể lưu tới tệp tin {}", done->filename);
+		}
+
+#ifdef EMSCRIPTEN
+		// Save changed file system
+		EM_ASM({
+			FS.syncfs(function(err) {
+			});
+		});
+#endif
+
+		if (done->on_done) {
+			done->on_done(success);
+		}
+	}
+}
+
+void SaveWriter::Write(FilesystemView fs, std::string filename, std::unique_ptr<lcf::rpg::Save> save,
+		lcf::EngineVersion engine, std::string encoding, Callback on_done) {
+	Flush();
+
+	job = std::make_unique<Job>();
+	job->fs = std::move(fs);
+	job->filename = std::move(filename);
+	job->save = std::move(save);
+	job->engine = engine;
+	job->encoding = std::move(encoding);
+	job->on_done = std::move(on_done);
+
+	// Without rename support the savegame is overwritten directly
+	job->write_filename = job->fs.IsFeatureSupported(Filesystem::Feature::Rename) ? job->filename + ".tmp" : job->filename;
+	job->os = job->fs.OpenOutputStream(job->write_filename);
+
+	if (!job->os) {
+		job->success = false;
+		Finish();
+		return;
+	}
+
+#ifdef HAVE_THREADS
+	worker_done = false;
+	worker = std::thread([] {
+		Serialize(*job);
+		worker_done = true;
+	});
+#else
+	Serialize(*job);
+	Finish();
+#endif
+}
+
+void SaveWriter::Update() {
+#ifdef HAVE_THREADS
+	if (job && worker_done) {
+		Finish();
+	}
+#endif
+}
+
+void SaveWriter::Flush() {
+	if (job) {
+		Finish();
+	}
+}
+
+bool SaveWriter::IsPending() {
+	return job != nullptr;
+}
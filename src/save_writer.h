@@ -0,0 +1,72 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_SAVE_WRITER_H
+#define EP_SAVE_WRITER_H
+
+// Headers
+#include <functional>
+#include <memory>
+#include <string>
+#include <lcf/rpg/save.h>
+#include <lcf/saveopt.h>
+#include "filesystem.h"
+
+/**
+ * Writes savegames without blocking the game loop.
+ *
+ * The savegame is snapshotted by the caller on the main thread. Serializing
+ * and writing the file happens on a background thread into a temporary file
+ * that replaces the savegame when the write succeeded, an interrupted write
+ * never destroys the previous savegame.
+ * Opening and renaming files and reporting the result is done on the main
+ * thread by Update, the filesystem caches are not thread-safe.
+ *
+ * Without thread support the savegame is written immediately.
+ */
+namespace SaveWriter {
+	/** Called on the main thread with the result of the write */
+	using Callback = std::function<void(bool success)>;
+
+	/**
+	 * Starts writing a savegame. A write that is still in progress is
+	 * finished first.
+	 *
+	 * @param fs filesystem of the save directory
+	 * @param filename savegame file in fs
+	 * @param save snapshot of the savegame
+	 * @param engine engine format of the savegame
+	 * @param encoding encoding of the strings in the savegame
+	 * @param on_done invoked when the file is written or the write failed
+	 */
+	void Write(FilesystemView fs, std::string filename, std::unique_ptr<lcf::rpg::Save> save,
+			lcf::EngineVersion engine, std::string encoding, Callback on_done = {});
+
+	/** Completes a finished background write, called every frame by the main thread */
+	void Update();
+
+	/**
+	 * Waits until the pending write is completed.
+	 * Must be called before a savegame is read.
+	 */
+	void Flush();
+
+	/** @return whether a write is in progress */
+	bool IsPending();
+}
+
+#endif
@@ -20,6 +20,7 @@
 #include "async_handler.h"
 #include "scene.h"
 #include "graphics.h"
+#include "instrumentation.h"
 #include "input.h"
 #include "player.h"
 #include "output.h"
@@ -139,6 +140,7 @@ void Scene::ScheduleTransitionIn(Scene::SceneType prev_scene_type) {
 }
 
 void Scene::MainFunction() {
+	Instrumentation::ZoneScope zone("Scene::MainFunction");
 	static bool init = false;
 
 	if (IsAsyncPending()) {
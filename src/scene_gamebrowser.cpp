@@ -197,7 +197,9 @@ void Scene_GameBrowser::BootGame() {
 		return;
 	}
 
-	if (!FileFinder::IsValidProject(fs)) {
+	// Reuse the result of the game list scanner when available
+	const auto state = gamelist_window->GetGameState();
+	if (state == GameScanner::State::Folder || (state != GameScanner::State::Game && !FileFinder::IsValidProject(fs))) {
 		// Not a game: Open as directory
 		load_window->SetVisible(false);
 		game_loading = false;
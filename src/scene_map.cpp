@@ -417,10 +417,16 @@ void Scene_Map::OnAsyncSuspend(F&& f, AsyncOp aop, bool is_preupdate) {
 
 	if (aop.GetType() == AsyncOp::eSave) {
 		auto savefs = FileFinder::Save();
-		bool success = Scene_Save::Save(savefs, aop.GetSaveSlot());
-		if (aop.GetSaveResultVar() > 0) {
-			Main_Data::game_variables->Set(aop.GetSaveResultVar(), success ? 1 : 0);
-			Game_Map::SetNeedRefresh(true);
+		const int result_var = aop.GetSaveResultVar();
+		if (result_var > 0) {
+			Scene_Save::Save(savefs, aop.GetSaveSlot(), true, [result_var](bool success) {
+				Main_Data::game_variables->Set(result_var, success ? 1 : 0);
+				Game_Map::SetNeedRefresh(true);
+			});
+			// The event reads the result in the next command
+			SaveWriter::Flush();
+		} else {
+			Scene_Save::Save(savefs, aop.GetSaveSlot());
 		}
 	}
 
@@ -40,6 +40,7 @@
 #include <lcf/lsd/reader.h>
 #include "output.h"
 #include "player.h"
+#include "save_writer.h"
 #include "scene_save.h"
 #include "translation.h"
 #include "version.h"
@@ -75,22 +76,40 @@ std::string Scene_Save::GetSaveFilename(const FilesystemView& fs, int slot_id) {
 	return filename;
 }
 
-bool Scene_Save::Save(const FilesystemView& fs, int slot_id, bool prepare_save) {
+void Scene_Save::Save(const FilesystemView& fs, int slot_id, bool prepare_save, SaveWriter::Callback on_done) {
 	const auto filename = GetSaveFilename(fs, slot_id);
 	Output::Debug("Saving to {}", filename);
 
-	auto save_stream = FileFinder::Save().OpenOutputStream(filename);
+	auto save = CreateSave(slot_id, prepare_save);
+	SaveWriter::Write(FileFinder::Save(), filename, std::move(save), GetEngineVersion(), Player::encoding, std::move(on_done));
 
-	if (!save_stream) {
-		Output::Warning("Không thể lưu tới tệp tin {}", filename);
-		return false;
-	}
-
-	return Save(save_stream, slot_id, prepare_save);
+	DynRpg::Save(slot_id);
 }
 
 bool Scene_Save::Save(std::ostream& os, int slot_id, bool prepare_save) {
-	lcf::rpg::Save save;
+	auto save = CreateSave(slot_id, prepare_save);
+	bool res = lcf::LSD_Reader::Save(os, *save, GetEngineVersion(), Player::encoding);
+
+	DynRpg::Save(slot_id);
+
+#ifdef EMSCRIPTEN
+	// Save changed file system
+	EM_ASM({
+		FS.syncfs(function(err) {
+		});
+	});
+#endif
+
+	return res;
+}
+
+lcf::EngineVersion Scene_Save::GetEngineVersion() {
+	return Player::IsRPG2k3() ? lcf::EngineVersion::e2k3 : lcf::EngineVersion::e2k;
+}
+
+std::unique_ptr<lcf::rpg::Save> Scene_Save::CreateSave(int slot_id, bool prepare_save) {
+	auto save_ptr = std::make_unique<lcf::rpg::Save>();
+	auto& save = *save_ptr;
 	auto& title = save.title;
 	// TODO: Maybe find a better place to setup the save file?
 
@@ -152,20 +171,8 @@ bool Scene_Save::Save(std::ostream& os, int slot_id, bool prepare_save) {
 			sme.map_id = 0;
 		}
 	}
-	auto lcf_engine = Player::IsRPG2k3() ? lcf::EngineVersion::e2k3 : lcf::EngineVersion::e2k;
-	bool res = lcf::LSD_Reader::Save(os, save, lcf_engine, Player::encoding);
 
-	DynRpg::Save(slot_id);
-
-#ifdef EMSCRIPTEN
-	// Save changed file system
-	EM_ASM({
-		FS.syncfs(function(err) {
-		});
-	});
-#endif
-
-	return res;
+	return save_ptr;
 }
 
 bool Scene_Save::IsSlotValid(int) {
@@ -19,7 +19,9 @@
 #define EP_SCENE_SAVE_H
 
 // Headers
+#include <memory>
 #include <vector>
+#include "save_writer.h"
 #include "scene.h"
 #include "scene_file.h"
 
@@ -40,8 +42,29 @@ public:
 	bool IsSlotValid(int index) override;
 
 	static std::string GetSaveFilename(const FilesystemView& tree, int slot_id);
-	static bool Save(const FilesystemView& tree, int slot_id, bool prepare_save = true);
+
+	/**
+	 * Saves the game. The file is written in the background by the SaveWriter.
+	 *
+	 * @param tree save directory
+	 * @param slot_id save slot
+	 * @param prepare_save whether the save count and the savegame version are updated
+	 * @param on_done invoked on the main thread when the file is written
+	 */
+	static void Save(const FilesystemView& tree, int slot_id, bool prepare_save = true, SaveWriter::Callback on_done = {});
 	static bool Save(std::ostream& os, int slot_id, bool prepare_save = true);
+
+	/**
+	 * Creates a snapshot of the current game state.
+	 *
+	 * @param slot_id save slot
+	 * @param prepare_save whether the save count and the savegame version are updated
+	 * @return savegame
+	 */
+	static std::unique_ptr<lcf::rpg::Save> CreateSave(int slot_id, bool prepare_save);
+
+	/** @return engine format of savegames of the current game */
+	static lcf::EngineVersion GetEngineVersion();
 };
 
 #endif
@@ -96,6 +96,10 @@ BitmapRef Sprite::Refresh(Rect& rect) {
 		bitmap_effects.reset();
 	}
 
+	// Flashes and tone transitions change the effect every frame
+	const bool effects_animated = !no_flash || (effects_changed && effects_changed_previous);
+	effects_changed_previous = effects_changed;
+
 	if (no_effects) {
 		return bitmap;
 	} else if (bitmap_effects) {
@@ -106,7 +110,12 @@ BitmapRef Sprite::Refresh(Rect& rect) {
 		current_flip_x = flipx_effect;
 		current_flip_y = flipy_effect;
 
-		bitmap_effects = Cache::SpriteEffect(bitmap, rect, flipx_effect, flipy_effect, current_tone, current_flash);
+		if (effects_animated) {
+			Cache::SpriteEffect(bitmap_effects_scratch, *bitmap, rect, flipx_effect, flipy_effect, current_tone, current_flash);
+			bitmap_effects = bitmap_effects_scratch;
+		} else {
+			bitmap_effects = Cache::SpriteEffect(bitmap, rect, flipx_effect, flipy_effect, current_tone, current_flash);
+		}
 		bitmap_effects_src_rect = rect;
 
 		return bitmap_effects;
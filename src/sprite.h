@@ -98,6 +98,9 @@ public:
 	 */
 	void SetWaverPhase(double phase);
 
+	/** @return flash effect color */
+	Color GetFlashEffect() const;
+
 	/**
 	 * Set the flash effect color
 	 */
@@ -127,6 +130,8 @@ private:
 	Color flash_effect;
 
 	BitmapRef bitmap_effects;
+	/** Reused for effects that change every frame, they bypass the cache */
+	BitmapRef bitmap_effects_scratch;
 
 	Rect bitmap_effects_src_rect;
 
@@ -137,6 +142,7 @@ private:
 	bool current_flip_x = false;
 	bool current_flip_y = false;
 	bool bitmap_changed = true;
+	bool effects_changed_previous = false;
 
 	void BlitScreen(Bitmap& dst);
 	void BlitScreenIntern(Bitmap& dst, Bitmap const& draw_bitmap,
@@ -296,6 +302,10 @@ inline void Sprite::SetBushDepth(int bush_depth) {
 	bush_effect = bush_depth;
 }
 
+inline Color Sprite::GetFlashEffect() const {
+	return flash_effect;
+}
+
 inline void Sprite::SetFlashEffect(const Color &color) {
 	flash_effect = color;
 }
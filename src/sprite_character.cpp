@@ -42,6 +42,7 @@ void Sprite_Character::Update() {
 	) {
 		tile_id = character->GetTileId();
 		character_name = character->GetSpriteName();
+		charset = Cache::Intern(character_name);
 		character_index = character->GetSpriteIndex();
 		refresh_bitmap = false;
 
@@ -100,7 +101,7 @@ void Sprite_Character::OnTileSpriteReady(FileRequestResult*) {
 
 	BitmapRef tile;
 	if (!chipset.empty()) {
-		tile = Cache::Tile(Game_Map::GetChipsetName(), tile_id);
+		tile = Cache::Tile(Cache::Intern(chipset), tile_id);
 	}
 	else {
 		tile = Bitmap::Create(16, 16, true);
@@ -141,7 +142,7 @@ Rect Sprite_Character::GetCharacterRect(StringView name, int index, const Rect b
 }
 
 void Sprite_Character::OnCharSpriteReady(FileRequestResult*) {
-	SetBitmap(Cache::Charset(character_name));
+	SetBitmap(Cache::Charset(charset));
 	auto rect = GetCharacterRect(character_name, character_index, GetBitmap()->GetRect());
 	chara_width = rect.width / 3;
 	chara_height = rect.height / 4;
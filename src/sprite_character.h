@@ -22,6 +22,7 @@
 #include "sprite.h"
 #include <string>
 #include "async_handler.h"
+#include "cache.h"
 
 class Game_Character;
 class FileRequestAsync;
@@ -86,6 +87,7 @@ private:
 
 	int tile_id;
 	std::string character_name;
+	Cache::AssetId charset;
 	int character_index;
 
 	int chara_width;
@@ -18,6 +18,7 @@
 // Headers
 #include <cstring>
 #include <cmath>
+#include <algorithm>
 #include "tilemap_layer.h"
 #include "output.h"
 #include "player.h"
@@ -29,6 +30,7 @@
 #include "game_system.h"
 #include "drawable_mgr.h"
 #include "baseui.h"
+#include "cache.h"
 
 // Blocks subtiles IDs
 // Mess with this code and you will die in 3 days...
@@ -250,6 +252,11 @@ void TilemapLayer::Draw(Bitmap& dst, uint8_t z_order) {
 	const int mod_ox = mod(ox, TILE_SIZE);
 	const int mod_oy = mod(oy, TILE_SIZE);
 
+	if (layer == 0 && autotiles) {
+		// The lower sublayer is drawn first, the background generation runs once per frame
+		PrepareAutotiles(div_ox, div_oy, tiles_x, tiles_y, animation_step_ab, z_order == TileBelow);
+	}
+
 	for (int y = 0; y < tiles_y; y++) {
 		for (int x = 0; x < tiles_x; x++) {
 
@@ -311,25 +318,31 @@ void TilemapLayer::Draw(Bitmap& dst, uint8_t z_order) {
 						// If Blocks A1, A2, B
 
 						// Draw the tile from autotile cache
-						TileXY pos = GetCachedAutotileAB(tile.ID, animation_step_ab);
+						TileXY pos = autotiles->GetAB(tile.ID, animation_step_ab);
+						if (!pos.valid) {
+							continue;
+						}
 
 						int col = pos.x;
 						int row = pos.y;
 
 						// Create tone changed tile
 						auto tone_hash = MakeAbTileHash(tile.ID,  animation_step_ab);
-						DrawTile(dst, *autotiles_ab_screen, *autotiles_ab_screen_effect, map_draw_x, map_draw_y, row, col, tone_hash, allow_fast_blit);
+						DrawTile(dst, *autotiles->GetBitmapAB(), *autotiles_ab_screen_effect, map_draw_x, map_draw_y, row, col, tone_hash, allow_fast_blit);
 					} else {
 						// If blocks D1-D12
 
 						// Draw the tile from autotile cache
-						TileXY pos = GetCachedAutotileD(tile.ID);
+						TileXY pos = autotiles->GetD(tile.ID);
+						if (!pos.valid) {
+							continue;
+						}
 
 						int col = pos.x;
 						int row = pos.y;
 
 						auto tone_hash = MakeDTileHash(tile.ID);
-						DrawTile(dst, *autotiles_d_screen, *autotiles_d_screen_effect, map_draw_x, map_draw_y, row, col, tone_hash, allow_fast_blit);
+						DrawTile(dst, *autotiles->GetBitmapD(), *autotiles_d_screen_effect, map_draw_x, map_draw_y, row, col, tone_hash, allow_fast_blit);
 					}
 				} else {
 					// If upper layer
@@ -359,19 +372,6 @@ void TilemapLayer::Draw(Bitmap& dst, uint8_t z_order) {
 	}
 }
 
-TilemapLayer::TileXY TilemapLayer::GetCachedAutotileAB(short ID, short animID) {
-	short block = ID / 1000;
-	short b_subtile = (ID - block * 1000) / 50;
-	short a_subtile = ID - block * 1000 - b_subtile * 50;
-	return autotiles_ab[animID][block][b_subtile][a_subtile];
-}
-
-TilemapLayer::TileXY TilemapLayer::GetCachedAutotileD(short ID) {
-	short block = (ID - 4000) / 50;
-	short subtile = ID - 4000 - block * 50;
-	return autotiles_d[block][subtile];
-}
-
 void TilemapLayer::CreateTileCache(const std::vector<short>& nmap_data) {
 	data_cache_vec.resize(width * height);
 	for (int x = 0; x < width; x++) {
@@ -409,7 +409,77 @@ void TilemapLayer::CreateTileCache(const std::vector<short>& nmap_data) {
 	}
 }
 
-void TilemapLayer::GenerateAutotileAB(short ID, short animID) {
+TilemapAutotiles::TilemapAutotiles(BitmapRef chipset) : chipset(std::move(chipset)) {
+}
+
+bool TilemapAutotiles::IsValidAB(short ID) {
+	if (ID < 0 || ID >= BLOCK_C) {
+		return false;
+	}
+
+	short block = ID / 1000;
+	short b_subtile = (ID - block * 1000) / 50;
+	short a_subtile = ID - block * 1000 - b_subtile * 50;
+	return b_subtile < 16 && a_subtile < 47;
+}
+
+bool TilemapAutotiles::IsValidD(short ID) {
+	return ID >= BLOCK_D && ID < BLOCK_D + 12 * 50;
+}
+
+bool TilemapAutotiles::HasAB(short ID, short animID) const {
+	if (!IsValidAB(ID)) {
+		return true;
+	}
+
+	short block = ID / 1000;
+	short b_subtile = (ID - block * 1000) / 50;
+	short a_subtile = ID - block * 1000 - b_subtile * 50;
+	return autotiles_ab[animID][block][b_subtile][a_subtile].valid;
+}
+
+bool TilemapAutotiles::HasD(short ID) const {
+	if (!IsValidD(ID)) {
+		return true;
+	}
+
+	short block = (ID - 4000) / 50;
+	short subtile = ID - 4000 - block * 50;
+	return autotiles_d[block][subtile].valid;
+}
+
+TilemapAutotiles::TileXY TilemapAutotiles::GetAB(short ID, short animID) {
+	if (EP_UNLIKELY(!IsValidAB(ID))) {
+		return {};
+	}
+
+	short block = ID / 1000;
+	short b_subtile = (ID - block * 1000) / 50;
+	short a_subtile = ID - block * 1000 - b_subtile * 50;
+
+	auto& tile = autotiles_ab[animID][block][b_subtile][a_subtile];
+	if (EP_UNLIKELY(!tile.valid)) {
+		tile = GenerateAB(ID, animID);
+	}
+	return tile;
+}
+
+TilemapAutotiles::TileXY TilemapAutotiles::GetD(short ID) {
+	if (EP_UNLIKELY(!IsValidD(ID))) {
+		return {};
+	}
+
+	short block = (ID - 4000) / 50;
+	short subtile = ID - 4000 - block * 50;
+
+	auto& tile = autotiles_d[block][subtile];
+	if (EP_UNLIKELY(!tile.valid)) {
+		tile = GenerateD(ID);
+	}
+	return tile;
+}
+
+TilemapAutotiles::TileXY TilemapAutotiles::GenerateAB(short ID, short animID) {
 	// Calculate the block to use
 	//	1: A1 + Upper B (Grass + Coast)
 	//	2: A2 + Upper B (Snow + Coast)
@@ -418,22 +488,9 @@ void TilemapLayer::GenerateAutotileAB(short ID, short animID) {
 
 	// Calculate the B block combination
 	short b_subtile = (ID - block * 1000) / 50;
-	if (b_subtile >= TILE_SIZE) {
-		Output::Warning("ID AB autotile không hợp lệ: {} (b_subtile = {})",
-						ID, b_subtile);
-		return;
-	}
 
 	// Calculate the A block combination
 	short a_subtile = ID - block * 1000 - b_subtile * 50;
-	if (a_subtile >= 47) {
-		Output::Warning("ID AB autotile không hợp lệ: {} (a_subtile = {})",
-						ID, a_subtile);
-		return;
-	}
-
-	if (autotiles_ab[animID][block][b_subtile][a_subtile].valid)
-		return;
 
 	uint8_t quarters[2][2][2];
 
@@ -491,37 +548,16 @@ void TilemapLayer::GenerateAutotileAB(short ID, short animID) {
 				quarters_hash |= quarters[j][i][k];
 			}
 
-	// check whether we have already generated this tile
-	auto it = autotiles_ab_map.find(quarters_hash);
-	if (it != autotiles_ab_map.end()) {
-		autotiles_ab[animID][block][b_subtile][a_subtile] = it->second;
-		return;
-	}
-
-	int id = autotiles_ab_next++;
-	int dst_x = id % TILES_PER_ROW;
-	int dst_y = id / TILES_PER_ROW;
-
-	TileXY tile_xy(dst_x, dst_y);
-	autotiles_ab_map[quarters_hash] = tile_xy;
-	autotiles_ab[animID][block][b_subtile][a_subtile] = tile_xy;
+	return Insert(sheet_ab, quarters_hash);
 }
 
-void TilemapLayer::GenerateAutotileD(short ID) {
+TilemapAutotiles::TileXY TilemapAutotiles::GenerateD(short ID) {
 	// Calculate the D block id
 	short block = (ID - 4000) / 50;
 
 	// Calculate the D block combination
 	short subtile = ID - 4000 - block * 50;
 
-	if (block >= 12 || subtile >= 50 || block < 0 || subtile < 0) {
-		Output::Warning("Chỉ mục Tilemap nằm ngoài phạm vi: {} {}", block, subtile);
-		return;
-	}
-
-	if (autotiles_d[block][subtile].valid)
-		return;
-
 	uint8_t quarters[2][2][2];
 
 	// Get Block chipset coords
@@ -554,54 +590,173 @@ void TilemapLayer::GenerateAutotileD(short ID) {
 				quarters_hash |= quarters[j][i][k];
 			}
 
+	return Insert(sheet_d, quarters_hash);
+}
+
+TilemapAutotiles::TileXY TilemapAutotiles::Insert(Sheet& sheet, uint32_t quarters_hash) {
 	// check whether we have already generated this tile
-	auto it = autotiles_d_map.find(quarters_hash);
-	if (it != autotiles_d_map.end()) {
-		autotiles_d[block][subtile] = it->second;
-		return;
+	auto it = sheet.map.find(quarters_hash);
+	if (it != sheet.map.end()) {
+		return it->second;
+	}
+
+	int id = sheet.next++;
+	TileXY dst(id % TILES_PER_ROW, id / TILES_PER_ROW);
+	Reserve(sheet, dst.y + 1);
+
+	Rect rect(0, 0, TILE_SIZE/2, TILE_SIZE/2);
+
+	// unpack the quarters data
+	uint32_t hash = quarters_hash;
+	for (int j = 0; j < 2; j++) {
+		for (int i = 0; i < 2; i++) {
+			int x = hash >> 28;
+			hash <<= 4;
+
+			int y = hash >> 28;
+			hash <<= 4;
+
+			rect.x = (x * 2 + i) * (TILE_SIZE/2);
+			rect.y = (y * 2 + j) * (TILE_SIZE/2);
+
+			sheet.bitmap->BlitFast((dst.x * 2 + i) * (TILE_SIZE / 2), (dst.y * 2 + j) * (TILE_SIZE / 2), *chipset, rect, 255);
+		}
 	}
 
-	int id = autotiles_d_next++;
-	int dst_x = id % TILES_PER_ROW;
-	int dst_y = id / TILES_PER_ROW;
+	sheet.bitmap->CheckTileOpacity(dst.x, dst.y);
 
-	TileXY tile_xy(dst_x, dst_y);
-	autotiles_d_map[quarters_hash] = tile_xy;
-	autotiles_d[block][subtile] = tile_xy;
+	sheet.map[quarters_hash] = dst;
+	return dst;
 }
 
-BitmapRef TilemapLayer::GenerateAutotiles(int count, const std::unordered_map<uint32_t, TileXY>& map) {
-	int rows = (count + TILES_PER_ROW - 1) / TILES_PER_ROW;
+void TilemapAutotiles::Reserve(Sheet& sheet, int rows) {
+	const int old_rows = sheet.bitmap ? sheet.bitmap->height() / TILE_SIZE : 0;
+	if (rows <= old_rows) {
+		return;
+	}
+
+	// Grow exponentially to amortize the copy
+	rows = std::max({rows, old_rows * 2, 4});
+
 	BitmapRef tiles = Bitmap::Create(TILES_PER_ROW * TILE_SIZE, rows * TILE_SIZE);
 	tiles->Clear();
-	Rect rect(0, 0, TILE_SIZE/2, TILE_SIZE/2);
+	if (sheet.bitmap) {
+		tiles->BlitFast(0, 0, *sheet.bitmap, sheet.bitmap->GetRect(), 255);
+	}
+	tiles->CheckPixels(Bitmap::Flag_Chipset);
 
-	for (auto& p: map) {
-		uint32_t quarters_hash = p.first;
-		TileXY dst = p.second;
+	sheet.bitmap = std::move(tiles);
+}
 
-		// unpack the quarters data
-		for (int j = 0; j < 2; j++) {
-			for (int i = 0; i < 2; i++) {
-				int x = quarters_hash >> 28;
-				quarters_hash <<= 4;
+void TilemapLayer::QueueAutotiles() {
+	autotiles_pending.clear();
 
-				int y = quarters_hash >> 28;
-				quarters_hash <<= 4;
+	if (!autotiles) {
+		return;
+	}
+
+	// Collect every autotile of the map once. They are generated on first
+	// use while drawing, the remaining ones are generated in the background
+	// with a budget per frame.
+	std::vector<bool> queued(BLOCK_E);
+	for (auto& tile: data_cache_vec) {
+		short ID = tile.ID;
+		if (ID < 0 || ID >= BLOCK_E || (ID >= BLOCK_C && ID < BLOCK_D) || queued[ID]) {
+			continue;
+		}
+		queued[ID] = true;
+
+		if (ID < BLOCK_C) {
+			// If blocks A and B
+			if (!TilemapAutotiles::IsValidAB(ID)) {
+				short block = ID / 1000;
+				short b_subtile = (ID - block * 1000) / 50;
+				short a_subtile = ID - block * 1000 - b_subtile * 50;
+				if (b_subtile >= TILE_SIZE) {
+					Output::Warning("ID AB autotile không hợp lệ: {} (b_subtile = {})",
+									ID, b_subtile);
+				} else {
+					Output::Warning("ID AB autotile không hợp lệ: {} (a_subtile = {})",
+									ID, a_subtile);
+				}
+				continue;
+			}
+		} else {
+			// If block D
+			if (!TilemapAutotiles::IsValidD(ID)) {
+				short block = (ID - 4000) / 50;
+				short subtile = ID - 4000 - block * 50;
+				Output::Warning("Chỉ mục Tilemap nằm ngoài phạm vi: {} {}", block, subtile);
+				continue;
+			}
+		}
+
+		autotiles_pending.push_back(ID);
+	}
+}
+
+void TilemapLayer::PrepareAutotiles(int div_ox, int div_oy, int tiles_x, int tiles_y, int animation_step_ab, bool generate_pending) {
+	// Generating autotiles can reallocate the autotile bitmaps. This must
+	// happen before any tile is drawn because a ParallelRenderer may still
+	// reference the bitmaps until the end of the frame.
+	const bool loop_h = Game_Map::LoopHorizontal();
+	const bool loop_v = Game_Map::LoopVertical();
+
+	auto mod = [](int n, int m) {
+		int rem = n % m;
+		return rem >= 0 ? rem : m + rem;
+	};
 
-				rect.x = (x * 2 + i) * (TILE_SIZE/2);
-				rect.y = (y * 2 + j) * (TILE_SIZE/2);
+	for (int y = 0; y < tiles_y; y++) {
+		for (int x = 0; x < tiles_x; x++) {
+			int map_x = div_ox + x;
+			int map_y = div_oy + y;
+			if (loop_h) map_x = mod(map_x, width);
+			if (loop_v) map_y = mod(map_y, height);
+
+			if (map_x < 0 || map_x >= width || map_y < 0 || map_y >= height) {
+				continue;
+			}
 
-				tiles->BlitFast((dst.x * 2 + i) * (TILE_SIZE / 2), (dst.y * 2 + j) * (TILE_SIZE / 2), *chipset, rect, 255);
+			short ID = GetDataCache(map_x, map_y).ID;
+			if (ID < BLOCK_C) {
+				autotiles->GetAB(ID, animation_step_ab);
+			} else if (ID >= BLOCK_D && ID < BLOCK_E) {
+				autotiles->GetD(ID);
 			}
 		}
 	}
 
-	if (rows > 0) {
-		tiles->CheckPixels(Bitmap::Flag_Chipset | Bitmap::Flag_ReadOnly);
+	if (generate_pending) {
+		int budget = autotiles_per_frame;
+		while (budget > 0 && !autotiles_pending.empty()) {
+			short ID = autotiles_pending.back();
+			autotiles_pending.pop_back();
+
+			if (ID < BLOCK_C) {
+				for (short anim = 0; anim < 3; ++anim) {
+					if (!autotiles->HasAB(ID, anim)) {
+						autotiles->GetAB(ID, anim);
+						--budget;
+					}
+				}
+			} else if (!autotiles->HasD(ID)) {
+				autotiles->GetD(ID);
+				--budget;
+			}
+		}
 	}
 
-	return tiles;
+	// The tone bitmaps must have the size of the autotile bitmaps
+	auto resize_effect = [this](BitmapRef& effect, BitmapRef const& screen) {
+		if (!screen || (effect && effect->height() == screen->height())) {
+			return;
+		}
+		effect = Bitmap::Create(screen->width(), screen->height());
+		chipset_tone_tiles.clear();
+	};
+	resize_effect(autotiles_ab_screen_effect, autotiles->GetBitmapAB());
+	resize_effect(autotiles_d_screen_effect, autotiles->GetBitmapD());
 }
 
 void TilemapLayer::SetChipset(BitmapRef const& nchipset) {
@@ -609,48 +764,20 @@ void TilemapLayer::SetChipset(BitmapRef const& nchipset) {
 	chipset_effect = Bitmap::Create(chipset->width(), chipset->height());
 	chipset_tone_tiles.clear();
 
-	if (autotiles_ab_next != 0 && autotiles_d_screen != nullptr && layer == 0) {
-		autotiles_ab_screen = GenerateAutotiles(autotiles_ab_next, autotiles_ab_map);
-		autotiles_d_screen = GenerateAutotiles(autotiles_d_next, autotiles_d_map);
-
-		autotiles_ab_screen_effect = Bitmap::Create(autotiles_ab_screen->width(), autotiles_ab_screen->height());
-		autotiles_d_screen_effect = Bitmap::Create(autotiles_d_screen->width(), autotiles_d_screen->height());
+	if (layer == 0) {
+		autotiles = Cache::Autotiles(chipset);
+		autotiles_ab_screen_effect.reset();
+		autotiles_d_screen_effect.reset();
+		QueueAutotiles();
 	}
 }
 
 void TilemapLayer::SetMapData(std::vector<short> nmap_data) {
 	// Create the tiles data cache
 	CreateTileCache(nmap_data);
-	memset(autotiles_ab, 0, sizeof(autotiles_ab));
-	memset(autotiles_d, 0, sizeof(autotiles_d));
 
 	if (layer == 0) {
-		autotiles_ab_map.clear();
-		autotiles_d_map.clear();
-		autotiles_ab_next = 0;
-		autotiles_d_next = 0;
-		for (int y = 0; y < height; y++) {
-			for (int x = 0; x < width; x++) {
-
-				if (GetDataCache(x, y).ID < BLOCK_C) {
-					// If blocks A and B
-
-					GenerateAutotileAB(GetDataCache(x, y).ID, 0);
-					GenerateAutotileAB(GetDataCache(x, y).ID, 1);
-					GenerateAutotileAB(GetDataCache(x, y).ID, 2);
-				} else if (GetDataCache(x, y).ID >= BLOCK_D && GetDataCache(x, y).ID < BLOCK_E) {
-					// If block D
-
-					GenerateAutotileD(GetDataCache(x, y).ID);
-				}
-			}
-		}
-		autotiles_ab_screen = GenerateAutotiles(autotiles_ab_next, autotiles_ab_map);
-		autotiles_d_screen = GenerateAutotiles(autotiles_d_next, autotiles_d_map);
-
-		autotiles_ab_screen_effect = Bitmap::Create(autotiles_ab_screen->width(), autotiles_ab_screen->height());
-		autotiles_d_screen_effect = Bitmap::Create(autotiles_d_screen->width(), autotiles_d_screen->height());
-
+		QueueAutotiles();
 		chipset_tone_tiles.clear();
 	}
 
@@ -24,6 +24,7 @@
 #include <map>
 #include <unordered_set>
 #include <unordered_map>
+#include <memory>
 #include "system.h"
 #include "drawable.h"
 #include "tone.h"
@@ -32,6 +33,115 @@
 
 class TilemapLayer;
 
+/**
+ * Composite autotiles (blocks A, B and D) of a chipset.
+ *
+ * An autotile is generated on first use by combining the quarters of the
+ * chipset tiles. Autotiles with the same quarters share one tile of the
+ * bitmap. The bitmaps grow when new autotiles are generated.
+ *
+ * Maps using the same chipset share one instance (see Cache::Autotiles).
+ */
+class TilemapAutotiles {
+public:
+	struct TileXY {
+		uint8_t x;
+		uint8_t y;
+		bool valid;
+		TileXY() : valid(false) {}
+		TileXY(uint8_t x, uint8_t y) : x(x), y(y), valid(true) {}
+	};
+
+	explicit TilemapAutotiles(BitmapRef chipset);
+
+	TilemapAutotiles(const TilemapAutotiles&) = delete;
+	TilemapAutotiles& operator=(const TilemapAutotiles&) = delete;
+
+	/** @return chipset the autotiles are generated from */
+	BitmapRef const& GetChipset() const;
+
+	/** @return bitmap containing the block A and B autotiles, nullptr when none were generated */
+	BitmapRef const& GetBitmapAB() const;
+
+	/** @return bitmap containing the block D autotiles, nullptr when none were generated */
+	BitmapRef const& GetBitmapD() const;
+
+	/**
+	 * @param ID tile ID
+	 * @param animID animation step
+	 * @return true when the block A or B autotile was already generated
+	 */
+	bool HasAB(short ID, short animID) const;
+
+	/**
+	 * @param ID tile ID
+	 * @return true when the block D autotile was already generated
+	 */
+	bool HasD(short ID) const;
+
+	/**
+	 * Gets the tile position of a block A or B autotile, generating it when necessary.
+	 *
+	 * @param ID tile ID
+	 * @param animID animation step
+	 * @return position in GetBitmapAB, invalid when the ID is invalid
+	 */
+	TileXY GetAB(short ID, short animID);
+
+	/**
+	 * Gets the tile position of a block D autotile, generating it when necessary.
+	 *
+	 * @param ID tile ID
+	 * @return position in GetBitmapD, invalid when the ID is invalid
+	 */
+	TileXY GetD(short ID);
+
+	/**
+	 * @param ID tile ID
+	 * @return true when ID is a valid block A or B autotile
+	 */
+	static bool IsValidAB(short ID);
+
+	/**
+	 * @param ID tile ID
+	 * @return true when ID is a valid block D autotile
+	 */
+	static bool IsValidD(short ID);
+
+	static const int TILES_PER_ROW = 64;
+
+private:
+	struct Sheet {
+		BitmapRef bitmap;
+		std::unordered_map<uint32_t, TileXY> map;
+		int next = 0;
+	};
+
+	TileXY GenerateAB(short ID, short animID);
+	TileXY GenerateD(short ID);
+	TileXY Insert(Sheet& sheet, uint32_t quarters_hash);
+	void Reserve(Sheet& sheet, int rows);
+
+	BitmapRef chipset;
+	Sheet sheet_ab;
+	Sheet sheet_d;
+
+	TileXY autotiles_ab[3][3][16][47] = {};
+	TileXY autotiles_d[12][50] = {};
+};
+
+inline BitmapRef const& TilemapAutotiles::GetChipset() const {
+	return chipset;
+}
+
+inline BitmapRef const& TilemapAutotiles::GetBitmapAB() const {
+	return sheet_ab.bitmap;
+}
+
+inline BitmapRef const& TilemapAutotiles::GetBitmapD() const {
+	return sheet_d.bitmap;
+}
+
 /**
  * TilemapSubLayer class.
  */
@@ -111,38 +221,22 @@ private:
 	bool fast_blit = false;
 
 	void CreateTileCache(const std::vector<short>& nmap_data);
-	void GenerateAutotileAB(short ID, short animID);
-	void GenerateAutotileD(short ID);
+	void QueueAutotiles();
+	void PrepareAutotiles(int div_ox, int div_oy, int tiles_x, int tiles_y, int animation_step_ab, bool generate_pending);
 	void DrawTile(Bitmap& dst, Bitmap& tile, Bitmap& tone_tile, int x, int y, int row, int col, uint32_t tone_hash, bool allow_fast_blit = true);
 	void DrawTileImpl(Bitmap& dst, Bitmap& tile, Bitmap& tone_tile, int x, int y, int row, int col, uint32_t tone_hash, ImageOpacity op, bool allow_fast_blit);
 
-	static const int TILES_PER_ROW = 64;
+	using TileXY = TilemapAutotiles::TileXY;
 
-	struct TileXY {
-		uint8_t x;
-		uint8_t y;
-		bool valid;
-		TileXY() : valid(false) {}
-		TileXY(uint8_t x, uint8_t y) : x(x), y(y), valid(true) {}
-	};
-
-	BitmapRef GenerateAutotiles(int count, const std::unordered_map<uint32_t, TileXY>& map);
+	/** Maximum number of not yet visible autotile IDs generated per frame */
+	static constexpr int autotiles_per_frame = 16;
 
-	TileXY GetCachedAutotileAB(short ID, short animID);
-	TileXY GetCachedAutotileD(short ID);
-	BitmapRef autotiles_ab_screen;
+	std::shared_ptr<TilemapAutotiles> autotiles;
 	BitmapRef autotiles_ab_screen_effect;
-	BitmapRef autotiles_d_screen;
 	BitmapRef autotiles_d_screen_effect;
 
-	int autotiles_ab_next = -1;
-	int autotiles_d_next = -1;
-
-	TileXY autotiles_ab[3][3][16][47] = {};
-	TileXY autotiles_d[12][50] = {};
-
-	std::unordered_map<uint32_t, TileXY> autotiles_ab_map;
-	std::unordered_map<uint32_t, TileXY> autotiles_d_map;
+	/** Autotile IDs of the map that were not generated yet */
+	std::vector<short> autotiles_pending;
 
 	struct TileData {
 		short ID;
@@ -18,9 +18,12 @@
 #include "translation.h"
 
 // Headers
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <memory>
+#include <zlib.h>
 #include <lcf/data.h>
 #include <lcf/rpg/terms.h>
 #include <lcf/rpg/map.h>
@@ -28,6 +31,7 @@
 
 #include "cache.h"
 #include "font.h"
+#include "game_config.h"
 #include "main_data.h"
 #include "game_actors.h"
 #include "game_map.h"
@@ -54,6 +58,99 @@
 #define TRCUST_REMOVEMSG        "<easyrpg:delete_page>"
 #define TRCUST_ADDMSG           "<easyrpg:new_page>"
 
+// Directory in the config directory containing the compiled dictionaries
+#define TRCACHE_DIR_NAME "translation_cache"
+
+namespace {
+	uint64_t HashString(uint64_t hash, StringView str) {
+		// FNV-1a
+		for (char c: str) {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	constexpr uint64_t hash_basis = 14695981039346656037ull;
+
+	/**
+	 * @return name of the cache file of a .po file, there is one per .po file
+	 * and it is replaced when the .po file changes
+	 */
+	std::string MakeCachedDictionaryFilename(StringView name) {
+		return fmt::format("{:016x}.bin", HashString(hash_basis, name));
+	}
+
+	/**
+	 * Reads a compiled dictionary from the cache.
+	 * The cache file starts with the key of the .po file, followed by the compiled dictionary.
+	 * The key contains the size and checksum of the .po file, the entry is outdated when it differs.
+	 */
+	bool ReadCachedDictionary(const FilesystemView& fs, StringView name, StringView key, Dictionary& out) {
+		auto filename = MakeCachedDictionaryFilename(name);
+		if (!fs || !fs.Exists(filename)) {
+			return false;
+		}
+
+		auto is = fs.OpenInputStream(filename);
+		if (!is) {
+			return false;
+		}
+
+		auto data = Utils::ReadStream(is);
+
+		uint32_t key_size;
+		if (data.size() < sizeof(key_size)) {
+			return false;
+		}
+		memcpy(&key_size, data.data(), sizeof(key_size));
+		if (key_size != key.size() || data.size() < sizeof(key_size) + key_size ||
+				memcmp(&data[sizeof(key_size)], key.data(), key_size) != 0) {
+			// Outdated or hash collision
+			return false;
+		}
+
+		const size_t offset = sizeof(key_size) + key_size;
+		return Dictionary::FromBinary(out, Span<const uint8_t>(data.data() + offset, data.size() - offset));
+	}
+
+	/** Writes a compiled dictionary into the cache, replacing the entry of an older version of the .po file */
+	void WriteCachedDictionary(const FilesystemView& fs, StringView name, StringView key, const Dictionary& dict) {
+		if (!fs) {
+			return;
+		}
+
+		auto filename = MakeCachedDictionaryFilename(name);
+
+		// Written to a temporary file first, an interrupted write keeps the old entry
+		const bool rename = fs.IsFeatureSupported(Filesystem::Feature::Rename);
+		auto write_filename = rename ? filename + ".tmp" : filename;
+
+		auto os = fs.OpenOutputStream(write_filename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+		if (!os) {
+			Output::Debug("Translation: Cannot write {}", filename);
+			return;
+		}
+
+		const uint32_t key_size = static_cast<uint32_t>(key.size());
+		const auto data = dict.ToBinary();
+		os.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+		os.write(key.data(), key.size());
+		os.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+		const bool success = static_cast<bool>(os);
+		os.Close();
+
+		if (rename) {
+			if (!success || !fs.RenameFile(write_filename, filename)) {
+				Output::Debug("Translation: Cannot write {}", filename);
+				fs.RemoveFile(write_filename);
+			}
+			fs.ClearCache();
+		}
+	}
+}
+
 
 FilesystemView Tr::GetTranslationFilesystem() {
 	return Player::translation.GetRootTree();
@@ -80,6 +177,7 @@ void Translation::Reset()
 	ClearTranslationLookups();
 
 	translation_root_fs = FilesystemView();
+	dictionary_cache_fs = FilesystemView();
 	languages.clear();
 	current_language = {};
 	default_language = {};
@@ -90,6 +188,12 @@ void Translation::InitTranslations()
 	// Reset
 	Reset();
 
+	// Parsing large .po files is slow, the compiled dictionaries are cached
+	auto config_fs = Game_Config::GetGlobalConfigFilesystem();
+	if (config_fs && config_fs.MakeDirectory(TRCACHE_DIR_NAME, false)) {
+		dictionary_cache_fs = config_fs.Create(TRCACHE_DIR_NAME);
+	}
+
 	// Determine if the "languages" directory exists, and convert its case.
 	auto fs = FileFinder::Game();
 	auto game_tree = fs.ListDirectory();
@@ -217,7 +321,7 @@ void Translation::SelectLanguageAsync(FileRequestResult*, StringView lang_id) {
 	}
 
 	// Rewrite our database+messages (unless we are on the Default language).
-	// Note that map Message boxes are changed on map load, to avoid slowdown here.
+	// Note that map Message boxes are changed when their page is executed, to avoid slowdown here.
 	if (!current_language.lang_dir.empty()) {
 		RewriteDatabase();
 		RewriteTreemapNames();
@@ -495,20 +599,20 @@ namespace {
 		 * (for rewriting later).
 		 * Advances the index until after the last ShowMessage(2) command
 		 */
-		void BuildMessageString(std::stringstream& msg_str, std::vector<size_t>& indexes) {
+		void BuildMessageString(std::string& msg_str, std::vector<size_t>& indexes) {
 			// No change if we're not on the right command.
 			if (Done() || !CurrentIsShowMessage()) {
 				return;
 			}
 
 			// Add the first line
-			msg_str << CurrentCmdString() <<"\n";
+			AppendLine(msg_str);
 			indexes.push_back(index);
 			Advance();
 
 			// Build lines 2 through 4
 			while (!Done() && CurrentIsShowMessage2()) {
-				msg_str << CurrentCmdString() <<"\n";
+				AppendLine(msg_str);
 				indexes.push_back(index);
 				Advance();
 			}
@@ -520,7 +624,7 @@ namespace {
 		 * (for rewriting later).
 		 * Advances the index until after the (first) ShowChoice command (but it will likely still be on a ShowChoiceOption/End)
 		 */
-		void BuildChoiceString(std::stringstream& msg_str, std::vector<size_t>& indexes) {
+		void BuildChoiceString(std::string& msg_str, std::vector<size_t>& indexes) {
 			// No change if we're not on the right command.
 			if (Done() || !CurrentIsShowChoice()) {
 				return;
@@ -540,7 +644,7 @@ namespace {
 				if (indent == CurrentCmdIndent()) {
 					// Handle a new index
 					if (CurrentIsShowChoiceOption() && CurrentCmdParam(0,0) < 4) {
-						msg_str << CurrentCmdString() <<"\n";
+						AppendLine(msg_str);
 						indexes.push_back(index);
 					}
 
@@ -619,6 +723,13 @@ namespace {
 		}
 
 	private:
+		/** Append the string of the EventCommand at the index followed by a newline to "msg_str" */
+		void AppendLine(std::string& msg_str) const {
+			StringView line = CurrentCmdString();
+			msg_str.append(line.data(), line.size());
+			msg_str += '\n';
+		}
+
 		std::vector<lcf::rpg::EventCommand>& commands;
 		size_t index = 0;
 	};
@@ -626,9 +737,8 @@ namespace {
 
 
 
-std::vector<std::vector<std::string>> Translation::TranslateMessageStream(const Dictionary& dict, const std::stringstream& msg, char trimChar) {
+std::vector<std::vector<std::string>> Translation::TranslateMessageStream(const Dictionary& dict, std::string msgStr, char trimChar) {
 	// Prepare source string
-	std::string msgStr = msg.str();
 	if (msgStr.size()>0 && msgStr.back() == trimChar) {
 		msgStr.pop_back();
 	}
@@ -675,14 +785,14 @@ void Translation::RewriteEventCommandMessage(const Dictionary& dict, std::vector
 		// We only need to deal with either Message or Choice commands
 		if (commands.CurrentIsShowMessage()) {
 			// Build up the lines of Message texts
-			std::stringstream msg_str;
+			std::string msg_str;
 			std::vector<size_t> msg_indexes;
 			commands.BuildMessageString(msg_str, msg_indexes);
 
 			// Go through messages first, including possible choices
 			if (msg_indexes.size()>0) {
 				// Get our lines, possibly including "combined"
-				std::vector<std::vector<std::string>> msgs = TranslateMessageStream(dict, msg_str, '\n');
+				std::vector<std::vector<std::string>> msgs = TranslateMessageStream(dict, std::move(msg_str), '\n');
 				if (msgs.size()>0) {
 					// The complex replacement logic is based on the last message box, then all remaining things are simply left back in.
 					std::vector<std::string>& lines = msgs.back();
@@ -729,14 +839,14 @@ void Translation::RewriteEventCommandMessage(const Dictionary& dict, std::vector
 			// Note that commands.Advance() has already happened within the above code.
 		} else if (commands.CurrentIsShowChoice()) {
 			// Build up the lines of Choice elements
-			std::stringstream choice_str;
+			std::string choice_str;
 			std::vector<size_t> choice_indexes; // Number of entries == number of choices
 			commands.BuildChoiceString(choice_str, choice_indexes);
 
 			// Go through choices.
 			if (choice_indexes.size() > 0) {
 				// Translate, break back into lines.
-				std::vector<std::vector<std::string>> msgs = TranslateMessageStream(dict, choice_str, '\n');
+				std::vector<std::vector<std::string>> msgs = TranslateMessageStream(dict, std::move(choice_str), '\n');
 				if (msgs.size() > 0) {
 					// Logic here is also based on the last message box.
 					std::vector<std::string> &lines = msgs.back();
@@ -780,23 +890,61 @@ void Translation::RewriteEventCommandMessage(const Dictionary& dict, std::vector
 }
 
 void Translation::RewriteMapMessages(StringView map_name, lcf::rpg::Map& map) {
+	ClearMapMessages();
+
 	// Retrieve lookup for this map.
-	auto mapIt = maps.find(ToString(map_name));
-	if (mapIt==maps.end()) { return; }
+	if (maps.find(ToString(map_name)) == maps.end()) { return; }
 
-	// Rewrite all event commands on all pages.
+	// Rewriting large maps takes long, the pages are rewritten when they are executed.
+	this->map_name = ToString(map_name);
 	for (lcf::rpg::Event& ev : map.events) {
 		for (lcf::rpg::EventPage& pg : ev.pages) {
-			RewriteEventCommandMessage(*mapIt->second, pg.event_commands);
+			untranslated_pages.push_back(&pg);
 		}
 	}
+	std::sort(untranslated_pages.begin(), untranslated_pages.end());
+}
+
+void Translation::RewriteMapPageMessages(const lcf::rpg::EventPage& page) {
+	auto pageIt = std::lower_bound(untranslated_pages.begin(), untranslated_pages.end(), &page);
+	if (pageIt == untranslated_pages.end() || *pageIt != &page) {
+		return;
+	}
+
+	lcf::rpg::EventPage& pg = **pageIt;
+	untranslated_pages.erase(pageIt);
+
+	// The lookup is done here: The language can change while the map is loaded.
+	auto mapIt = maps.find(map_name);
+	if (mapIt != maps.end()) {
+		RewriteEventCommandMessage(*mapIt->second, pg.event_commands);
+	}
+}
+
+void Translation::ClearMapMessages() {
+	map_name.clear();
+	untranslated_pages.clear();
 }
 
 void Translation::ParsePoFile(Filesystem_Stream::InputStream is, Dictionary& out)
 {
-	if (is) {
-		Dictionary::FromPo(out, is);
+	if (!is) {
+		return;
 	}
+
+	auto data = Utils::ReadStream(is);
+	const auto crc = crc32(crc32(0L, Z_NULL, 0), data.data(), static_cast<uInt>(data.size()));
+	const auto key = fmt::format("{}:{}:{:08x}", is.GetName(), data.size(), crc);
+
+	if (ReadCachedDictionary(dictionary_cache_fs, is.GetName(), key, out)) {
+		return;
+	}
+
+	Filesystem_Stream::InputMemoryStreamBuf buf(std::move(data));
+	std::istream po(&buf);
+	Dictionary::FromPo(out, po);
+
+	WriteCachedDictionary(dictionary_cache_fs, is.GetName(), key, out);
 }
 
 void Translation::ClearTranslationLookups()
@@ -814,12 +962,146 @@ void Translation::ClearTranslationLookups()
 //////////////////////////////////////////////////////////
 
 
+namespace {
+	constexpr char dictionary_magic[4] = { 'E', 'P', 'T', 'R' };
+	// Increment when the format of the compiled dictionary changes
+	constexpr uint32_t dictionary_version = 1;
+	constexpr char context_separator = '\x04';
+
+	uint64_t HashKey(StringView context, StringView original) {
+		return HashString(HashString(HashString(hash_basis, context), StringView(&context_separator, 1)), original);
+	}
+}
+
 void Dictionary::addEntry(const Entry& entry)
 {
 	// Space-saving measure: If the translation string is empty, there's no need to save it (since we will just show the original).
-	if (!entry.translation.empty()) {
-		entries[entry.context][entry.original] = entry.translation;
+	if (entry.translation.empty()) {
+		return;
+	}
+
+	Item item;
+	item.hash = HashKey(entry.context, entry.original);
+	item.offset = static_cast<uint32_t>(pool.size());
+	item.key_size = static_cast<uint32_t>(entry.context.size() + 1 + entry.original.size());
+	item.value_offset = item.offset + item.key_size;
+	item.value_size = static_cast<uint32_t>(entry.translation.size());
+	items.push_back(item);
+
+	pool += entry.context;
+	pool += context_separator;
+	pool += entry.original;
+	pool += entry.translation;
+}
+
+void Dictionary::Compile() {
+	std::stable_sort(items.begin(), items.end(), [](const Item& l, const Item& r) {
+		return l.hash < r.hash;
+	});
+
+	auto key = [this](const Item& item) {
+		return StringView(pool).substr(item.offset, item.key_size);
+	};
+
+	// Duplicated keys: The last entry in the .po file wins
+	std::vector<Item> compiled;
+	compiled.reserve(items.size());
+	for (size_t i = 0; i < items.size(); ++i) {
+		bool replaced = false;
+		for (size_t j = i + 1; j < items.size() && items[j].hash == items[i].hash; ++j) {
+			if (key(items[j]) == key(items[i])) {
+				replaced = true;
+				break;
+			}
+		}
+		if (!replaced) {
+			compiled.push_back(items[i]);
+		}
+	}
+	items = std::move(compiled);
+}
+
+bool Dictionary::Lookup(StringView context, StringView original, StringView& translation) const {
+	const uint64_t hash = HashKey(context, original);
+	auto it = std::lower_bound(items.begin(), items.end(), hash, [](const Item& item, uint64_t hash) {
+		return item.hash < hash;
+	});
+
+	const StringView pool_view = pool;
+	for (; it != items.end() && it->hash == hash; ++it) {
+		if (it->key_size != context.size() + 1 + original.size()) {
+			continue;
+		}
+
+		auto key = pool_view.substr(it->offset, it->key_size);
+		if (key.substr(0, context.size()) == context && key[context.size()] == context_separator &&
+				key.substr(context.size() + 1) == original) {
+			translation = pool_view.substr(it->value_offset, it->value_size);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::vector<uint8_t> Dictionary::ToBinary() const {
+	// Header: magic, version, item count, pool size
+	// Followed by the items and the pool
+	static_assert(sizeof(Item) == 24, "Item must not contain padding");
+
+	const uint32_t item_count = static_cast<uint32_t>(items.size());
+	const uint32_t pool_size = static_cast<uint32_t>(pool.size());
+
+	std::vector<uint8_t> data(sizeof(dictionary_magic) + sizeof(uint32_t) * 3 + items.size() * sizeof(Item) + pool.size());
+	auto* out = data.data();
+	auto write = [&out](const void* src, size_t size) {
+		memcpy(out, src, size);
+		out += size;
+	};
+
+	write(dictionary_magic, sizeof(dictionary_magic));
+	write(&dictionary_version, sizeof(dictionary_version));
+	write(&item_count, sizeof(item_count));
+	write(&pool_size, sizeof(pool_size));
+	write(items.data(), items.size() * sizeof(Item));
+	write(pool.data(), pool.size());
+
+	return data;
+}
+
+bool Dictionary::FromBinary(Dictionary& res, Span<const uint8_t> data) {
+	const size_t header_size = sizeof(dictionary_magic) + sizeof(uint32_t) * 3;
+	if (data.size() < header_size || memcmp(data.data(), dictionary_magic, sizeof(dictionary_magic)) != 0) {
+		return false;
+	}
+
+	uint32_t version, item_count, pool_size;
+	memcpy(&version, &data[sizeof(dictionary_magic)], sizeof(version));
+	memcpy(&item_count, &data[sizeof(dictionary_magic) + sizeof(uint32_t)], sizeof(item_count));
+	memcpy(&pool_size, &data[sizeof(dictionary_magic) + sizeof(uint32_t) * 2], sizeof(pool_size));
+
+	if (version != dictionary_version || data.size() != header_size + static_cast<size_t>(item_count) * sizeof(Item) + pool_size) {
+		return false;
+	}
+
+	std::vector<Item> items(item_count);
+	memcpy(items.data(), &data[header_size], items.size() * sizeof(Item));
+
+	// Reject corrupted files instead of reading out of bounds
+	for (size_t i = 0; i < items.size(); ++i) {
+		const auto& item = items[i];
+		if (static_cast<uint64_t>(item.offset) + item.key_size > pool_size ||
+				static_cast<uint64_t>(item.value_offset) + item.value_size > pool_size ||
+				(i > 0 && items[i - 1].hash > item.hash)) {
+			return false;
+		}
 	}
+
+	const auto* pool_data = reinterpret_cast<const char*>(&data[header_size + items.size() * sizeof(Item)]);
+	res.items = std::move(items);
+	res.pool.assign(pool_data, pool_size);
+
+	return true;
 }
 
 // Returns success
@@ -838,7 +1120,7 @@ void Dictionary::FromPo(Dictionary& res, std::istream& in) {
 			return "";
 		}
 
-		std::stringstream out;
+		std::string out;
 		bool slash = false;
 		bool first_quote = false;
 
@@ -860,13 +1142,13 @@ void Dictionary::FromPo(Dictionary& res, std::istream& in) {
 				slash = false;
 				switch (c) {
 					case '\\':
-						out << c;
+						out += c;
 						break;
 					case 'n':
-						out << '\n';
+						out += '\n';
 						break;
 					case '"':
-						out << '"';
+						out += '"';
 						break;
 					default:
 						Output::Error(R"(Lỗi phân tích (dòng {}): \, \n hoặc " được mong muốn, nhưng lại nhận được "{}": {})", line_number, c, line);
@@ -876,14 +1158,14 @@ void Dictionary::FromPo(Dictionary& res, std::istream& in) {
 				// no-slash
 				if (c == '"') {
 					// done
-					return out.str();
+					return out;
 				}
-				out << c;
+				out += c;
 			}
 		}
 
 		Output::Error("Lỗi phân tích (dòng {}): Dòng không được kết thúc: {}", line_number, line);
-		return out.str();
+		return out;
 	};
 
 	auto read_msgstr = [&]() {
@@ -946,4 +1228,6 @@ void Dictionary::FromPo(Dictionary& res, std::istream& in) {
 			}
 		}
 	}
+
+	res.Compile();
 }
@@ -19,18 +19,22 @@
 #define EP_TRANSLATION_H
 
 // Headers
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "async_handler.h"
 #include "filefinder.h"
+#include "span.h"
 
 namespace lcf {
 	namespace rpg {
 		class Map;
 		class EventCommand;
+		class EventPage;
 	}
 	class DBString;
 }
@@ -86,6 +90,11 @@ public:
 
 /**
  * A .po file loaded into memory. Contains a dictionary of entries.
+ *
+ * The entries are compiled into a string pool and a table of their hashed
+ * keys (context and original string) sorted by hash. Lookups are binary
+ * searches that do not allocate. The compiled form can be stored in a binary
+ * file and loaded again without parsing the .po file.
  */
 class Dictionary {
 public:
@@ -99,6 +108,20 @@ public:
 	 */
 	static void FromPo(Dictionary& res, std::istream& in);
 
+	/**
+	 * Loads a dictionary compiled by ToBinary.
+	 *
+	 * @param res The dictionary to store the translated entries in.
+	 * @param data The compiled dictionary.
+	 * @return True if the data is a valid compiled dictionary; false otherwise.
+	 */
+	static bool FromBinary(Dictionary& res, Span<const uint8_t> data);
+
+	/**
+	 * @return The compiled dictionary, can be loaded with FromBinary.
+	 */
+	std::vector<uint8_t> ToBinary() const;
+
 	/**
 	 * Replace an original string with the translated string.
 	 * Template can be "std::string" or "lcf::DBString"
@@ -111,6 +134,21 @@ public:
 	template <class StringType>
 	bool TranslateString(StringView context, StringType& original) const;
 
+	/**
+	 * Lookup the translation of a string.
+	 *
+	 * @param context The 'context' of this string, see TranslateString.
+	 * @param original The string to lookup.
+	 * @param translation The translated string (output), valid as long as the dictionary.
+	 * @return True if a translation was found; false otherwise.
+	 */
+	bool Lookup(StringView context, StringView original, StringView& translation) const;
+
+	/**
+	 * @return Number of translated entries.
+	 */
+	size_t GetCount() const;
+
 private:
 	/**
 	 * Add an entry to the dictionary.
@@ -119,8 +157,22 @@ private:
 	 */
 	void addEntry(const Entry& entry);
 
-	// Lookup by context, where context can be empty ("") for no context.
-	std::unordered_map<std::string, std::unordered_map<std::string, std::string>> entries;
+	/**
+	 * Sort the entries by hash. Of entries with the same key the last one is kept.
+	 */
+	void Compile();
+
+	struct Item {
+		uint64_t hash;
+		// The key (context, '\x04', original) is followed by the translation in the pool.
+		uint32_t offset;
+		uint32_t key_size;
+		uint32_t value_offset;
+		uint32_t value_size;
+	};
+
+	std::vector<Item> items;
+	std::string pool;
 };
 
 
@@ -128,19 +180,18 @@ private:
 template <class StringType>
 bool Dictionary::TranslateString(StringView context, StringType& original) const
 {
-	std::stringstream key;
-	key << original;
-	auto it = entries.find(ToString(context));
-	if (it != entries.end()) {
-		auto it2 = it->second.find(key.str());
-		if (it2 != it->second.end()) {
-			original = StringType(it2->second);
-			return true;
-		}
+	StringView translation;
+	if (Lookup(context, StringView(original), translation)) {
+		original = StringType(translation);
+		return true;
 	}
 	return false;
 }
 
+inline size_t Dictionary::GetCount() const {
+	return items.size();
+}
+
 
 /**
  * Properties of a language
@@ -202,13 +253,26 @@ public:
 	void RequestAndAddMap(int map_id);
 
 	/**
-	 * Rewrite all Messages and Choices in this Map
+	 * Prepare rewriting all Messages and Choices in this Map.
+	 * The pages are rewritten lazily by RewriteMapPageMessages when they are executed the first time.
 	 *
 	 * @param map_name The name of the map with formatting similar to the .po file; e.g., "map0104.po"
 	 * @param map The map object itself (for modifying).
 	 */
 	void RewriteMapMessages(StringView map_name, lcf::rpg::Map& map);
 
+	/**
+	 * Rewrite all Messages and Choices of an event page of the current map unless this already happened.
+	 *
+	 * @param page A page of the map passed to RewriteMapMessages.
+	 */
+	void RewriteMapPageMessages(const lcf::rpg::EventPage& page);
+
+	/**
+	 * Forget the pages of the current map, called when the map is disposed.
+	 */
+	void ClearMapMessages();
+
 	/**
 	 * Retrieve the current language.
 	 *
@@ -276,7 +340,7 @@ private:
 	 *         It is guaranteed that each MessageBox vector will have at least one entry (containing "") if it would otherwise be empty; this can happen
 	 *         if the message box insertion commands are used. Note that the last MessageBox vector may contain translated "Choice" entries (it is based on the input).
 	 */
-	std::vector<std::vector<std::string>> TranslateMessageStream(const Dictionary& dict, const std::stringstream& msg, char trimChar);
+	std::vector<std::vector<std::string>> TranslateMessageStream(const Dictionary& dict, std::string msg, char trimChar);
 
 	/**
 	 * Rewrite a list of event commands (from any map, battle, or common event) given a dictionary.
@@ -304,6 +368,13 @@ private:
 	std::unique_ptr<Dictionary> mapnames;  // RPG_RT.lmt.po (map names, used only in the "Teleport" event command)
 	std::unordered_map<std::string, std::unique_ptr<Dictionary>> maps;  // map<id>.po, indexed by map name
 
+	// Compiled dictionaries of already parsed .po files
+	FilesystemView dictionary_cache_fs;
+
+	// The current map and its pages that were not executed yet, sorted by address.
+	std::string map_name;
+	std::vector<lcf::rpg::EventPage*> untranslated_pages;
+
 	// Our list of available Languages (translations, localizations), determined by scanning the files on disk.
 	std::vector<Language> languages;
 
@@ -24,6 +24,7 @@
 #include "game_system.h"
 #include "bitmap.h"
 #include "font.h"
+#include "frame_stats.h"
 #include "player.h"
 
 Window_Base::Window_Base(int x, int y, int width, int height, Drawable::Flags flags)
@@ -98,6 +99,11 @@ void Window_Base::OnFaceReady(FileRequestResult* result, int face_index, int cx,
 	else {
 		contents->Blit(cx, cy, *faceset, src_rect, 255);
 	}
+
+	if (!drawing_face) {
+		// Loaded asynchronously: Regions drawn over the face are outdated
+		InvalidateRegions();
+	}
 }
 
 // All these functions assume that the input is valid
@@ -108,7 +114,9 @@ void Window_Base::DrawFace(StringView face_name, int face_index, int cx, int cy,
 	FileRequestAsync* request = AsyncHandler::RequestFile("FaceSet", face_name);
 	request->SetGraphicFile(true);
 	face_request_ids.push_back(request->Bind(&Window_Base::OnFaceReady, this, face_index, cx, cy, flip));
+	drawing_face = true;
 	request->Start();
+	drawing_face = false;
 }
 
 void Window_Base::DrawActorFace(const Game_Actor& actor, int cx, int cy) {
@@ -343,3 +351,47 @@ int Window_Base::GetValueFontColor(int have, int max, bool can_knockout) const {
 	if (max > 0 && (have <= max / 4)) return Font::ColorCritical;
 	return Font::ColorDefault;
 }
+
+uint64_t Window_Base::MakeRegionKey(std::initializer_list<int64_t> values, StringView text) {
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+	auto add = [&hash](uint8_t byte) {
+		hash ^= byte;
+		hash *= 1099511628211ull;
+	};
+
+	for (int64_t value: values) {
+		for (int i = 0; i < 8; ++i) {
+			add(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (i * 8)));
+		}
+	}
+	for (char c: text) {
+		add(static_cast<uint8_t>(c));
+	}
+	return hash;
+}
+
+bool Window_Base::IsRegionDirty(int region, uint64_t key) {
+	if (region >= static_cast<int>(regions.size())) {
+		regions.resize(region + 1);
+	}
+
+	auto& r = regions[region];
+	if (r.valid && r.key == key) {
+		return false;
+	}
+
+	r.key = key;
+	r.valid = true;
+	return true;
+}
+
+void Window_Base::InvalidateRegions() {
+	for (auto& r: regions) {
+		r.valid = false;
+	}
+}
+
+void Window_Base::CountRedraw(const Rect& rect) const {
+	FrameStats::AddRedrawnPixels(rect.width * rect.height);
+}
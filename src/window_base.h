@@ -20,7 +20,10 @@
 
 // Headers
 #include <array>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
+#include <vector>
 #include "window.h"
 #include "game_actor.h"
 #include "main_data.h"
@@ -86,8 +89,51 @@ public:
 protected:
 	void OnFaceReady(FileRequestResult* result, int face_index, int cx, int cy, bool flip);
 
+	/**
+	 * Retained contents.
+	 * Parts of the contents that are refreshed every frame (e.g. gauges) are
+	 * split into regions that are only redrawn when the values they are drawn
+	 * from changed.
+	 */
+	/** @{ */
+	/**
+	 * Creates the key of a region from the values it is drawn from.
+	 *
+	 * @param values numeric values
+	 * @param text text value
+	 * @return key
+	 */
+	static uint64_t MakeRegionKey(std::initializer_list<int64_t> values, StringView text = {});
+
+	/**
+	 * Checks whether a region must be redrawn and stores the new key.
+	 *
+	 * @param region index of the region
+	 * @param key key created by MakeRegionKey
+	 * @return true when the key changed or the regions were invalidated
+	 */
+	bool IsRegionDirty(int region, uint64_t key);
+
+	/** Marks all regions dirty, needed after the contents were cleared */
+	void InvalidateRegions();
+
+	/**
+	 * Counts redrawn pixels of the contents for the frame statistics.
+	 *
+	 * @param rect redrawn area
+	 */
+	void CountRedraw(const Rect& rect) const;
+	/** @} */
+
 	std::vector<FileRequestBinding> face_request_ids;
 
+	struct Region {
+		uint64_t key = 0;
+		bool valid = false;
+	};
+	std::vector<Region> regions;
+	bool drawing_face = false;
+
 	int current_frame = 0;
 	int total_frames = 0;
 	std::array<int, 2> old_position;
@@ -63,6 +63,8 @@ Window_BattleStatus::Window_BattleStatus(int ix, int iy, int iwidth, int iheight
 
 void Window_BattleStatus::Refresh() {
 	contents->Clear();
+	InvalidateRegions();
+	CountRedraw(contents->GetRect());
 
 	if (enemy) {
 		item_max = Main_Data::game_enemyparty->GetBattlerCount();
@@ -74,14 +76,7 @@ void Window_BattleStatus::Refresh() {
 	item_max = std::min(item_max, 4);
 
 	for (int i = 0; i < item_max; i++) {
-		// The party only contains valid battlers
-		const Game_Battler* actor;
-		if (enemy) {
-			actor = &(*Main_Data::game_enemyparty)[i];
-		}
-		else {
-			actor = &(*Main_Data::game_party)[i];
-		}
+		const Game_Battler* actor = &GetBattler(i);
 
 		if (!enemy && lcf::Data::battlecommands.battle_type == lcf::rpg::BattleCommands::BattleType_gauge) {
 			DrawActorFace(*static_cast<const Game_Actor*>(actor), 80 * i, actor_face_height);
@@ -110,81 +105,140 @@ void Window_BattleStatus::Refresh() {
 	RefreshGauge();
 }
 
+const Game_Battler& Window_BattleStatus::GetBattler(int i) const {
+	// The party always contains valid battlers
+	if (enemy) {
+		return (*Main_Data::game_enemyparty)[i];
+	}
+	return (*Main_Data::game_party)[i];
+}
+
+int Window_BattleStatus::GetGaugeState(int cur_value, int max_value) {
+	// Gauges are drawn with a width of 25 pixels and change their color when full
+	if (max_value <= 0) {
+		return -1;
+	}
+	return (25 * cur_value / max_value) * 2 + (cur_value == max_value ? 1 : 0);
+}
+
 void Window_BattleStatus::RefreshGauge() {
-	if (Feature::HasRpg2k3BattleSystem()) {
-		if (lcf::Data::battlecommands.battle_type == lcf::rpg::BattleCommands::BattleType_alternative) {
-			if (lcf::Data::battlecommands.window_size == lcf::rpg::BattleCommands::WindowSize_small) {
-				contents->ClearRect(Rect(192, 0, 45, 58));
-			} else {
-				contents->ClearRect(Rect(192, 0, 45, 64));
-			}
+	if (!Feature::HasRpg2k3BattleSystem()) {
+		return;
+	}
+
+	// Called every frame: The gauges are only redrawn when their values changed
+	const auto battle_type = lcf::Data::battlecommands.battle_type;
+	if (!enemy && battle_type == lcf::rpg::BattleCommands::BattleType_gauge) {
+		BitmapRef system2 = Cache::System2();
+		if (!system2) {
+			return;
 		}
 
+		// The right end of a gauge overlaps the face of the next actor:
+		// All actors after the first changed one are redrawn
+		bool redraw = false;
 		for (int i = 0; i < item_max; ++i) {
-			// The party always contains valid battlers
-			Game_Battler* actor;
-			if (enemy) {
-				actor = &(*Main_Data::game_enemyparty)[i];
-			}
-			else {
-				actor = &(*Main_Data::game_party)[i];
+			const auto& actor = static_cast<const Game_Actor&>(GetBattler(i));
+
+			const auto key = MakeRegionKey({
+				reinterpret_cast<intptr_t>(system2.get()),
+				actor.GetFaceIndex(),
+				actor.GetHp(), GetGaugeState(actor.GetHp(), actor.GetMaxHp()),
+				actor.GetSp(), GetGaugeState(actor.GetSp(), actor.GetMaxSp()),
+				GetGaugeState(actor.GetAtbGauge(), actor.GetMaxAtbGauge())
+			}, actor.GetFaceName());
+			redraw = IsRegionDirty(i, key) || redraw;
+			if (!redraw) {
+				continue;
 			}
 
-			if (!enemy && lcf::Data::battlecommands.battle_type == lcf::rpg::BattleCommands::BattleType_gauge) {
-				BitmapRef system2 = Cache::System2();
-				if (system2) {
-					// Clear number and gauge drawing area
-					contents->ClearRect(Rect(40 + 80 * i, actor_face_height, 8 * 4, 48));
-
-					// Number clearing removed part of the face, but both, clear and redraw
-					// are needed because some games don't have face graphics that are huge enough
-					// to clear the number area (e.g. Ara Fell)
-					DrawActorFace(*static_cast<const Game_Actor*>(actor), 80 * i, actor_face_height);
-
-					int x = 32 + i * 80;
-					int y = actor_face_height;
-
-					// Left Gauge
-					contents->Blit(x, y, *system2, Rect(0, 32, 16, 48), Opacity::Opaque());
-					x += 16;
-
-					// Center
-					const auto fill_x = x;
-					contents->StretchBlit(Rect(x, y, 25, 48), *system2, Rect(16, 32, 16, 48), Opacity::Opaque());
-					x += 25;
-
-					// Right
-					contents->Blit(x, y, *system2, Rect(32, 32, 16, 48), Opacity::Opaque());
-
-					// HP
-					DrawGaugeSystem2(fill_x, y, actor->GetHp(), actor->GetMaxHp(), 0);
-					// SP
-					DrawGaugeSystem2(fill_x, y + 16, actor->GetSp(), actor->GetMaxSp(), 1);
-					// Gauge
-					DrawGaugeSystem2(fill_x, y + 16 * 2, actor->GetAtbGauge(), actor->GetMaxAtbGauge(), 2);
-
-					// Numbers
-					x = 40 + 80 * i;
-					DrawNumberSystem2(x, y, actor->GetHp());
-					DrawNumberSystem2(x, y + 12 + 4, actor->GetSp());
-				}
+			// Clear number and gauge drawing area
+			contents->ClearRect(Rect(40 + 80 * i, actor_face_height, 8 * 4, 48));
+
+			// Number clearing removed part of the face, but both, clear and redraw
+			// are needed because some games don't have face graphics that are huge enough
+			// to clear the number area (e.g. Ara Fell)
+			DrawActorFace(actor, 80 * i, actor_face_height);
+
+			int x = 32 + i * 80;
+			int y = actor_face_height;
+			CountRedraw(Rect(80 * i, y, x + 16 + 25 + 16 - 80 * i, 48));
+
+			// Left Gauge
+			contents->Blit(x, y, *system2, Rect(0, 32, 16, 48), Opacity::Opaque());
+			x += 16;
+
+			// Center
+			const auto fill_x = x;
+			contents->StretchBlit(Rect(x, y, 25, 48), *system2, Rect(16, 32, 16, 48), Opacity::Opaque());
+			x += 25;
+
+			// Right
+			contents->Blit(x, y, *system2, Rect(32, 32, 16, 48), Opacity::Opaque());
+
+			// HP
+			DrawGaugeSystem2(fill_x, y, actor.GetHp(), actor.GetMaxHp(), 0);
+			// SP
+			DrawGaugeSystem2(fill_x, y + 16, actor.GetSp(), actor.GetMaxSp(), 1);
+			// Gauge
+			DrawGaugeSystem2(fill_x, y + 16 * 2, actor.GetAtbGauge(), actor.GetMaxAtbGauge(), 2);
+
+			// Numbers
+			x = 40 + 80 * i;
+			DrawNumberSystem2(x, y, actor.GetHp());
+			DrawNumberSystem2(x, y + 12 + 4, actor.GetSp());
+		}
+	} else if (battle_type == lcf::rpg::BattleCommands::BattleType_alternative) {
+		const bool opaque = lcf::Data::battlecommands.transparency == lcf::rpg::BattleCommands::Transparency_opaque;
+
+		// The gauge column is cleared as a whole, it is one region
+		uint64_t key = MakeRegionKey({ reinterpret_cast<intptr_t>(Cache::System2().get()), item_max });
+		for (int i = 0; i < item_max; ++i) {
+			const auto& actor = GetBattler(i);
+			key = MakeRegionKey({
+				static_cast<int64_t>(key),
+				// RPG_RT Bug (?): Gauge hidden when selected due to transparency (wrong color when rendering)
+				opaque || index != i,
+				GetGaugeState(actor.GetAtbGauge(), actor.GetMaxAtbGauge()),
+				actor.GetHp(), actor.GetMaxHp(), actor.MaxHpValue(),
+				actor.GetSp(), actor.GetMaxSp(), actor.MaxSpValue()
+			});
+		}
+		if (!IsRegionDirty(0, key)) {
+			return;
+		}
+
+		const Rect column(192, 0, 45, lcf::Data::battlecommands.window_size == lcf::rpg::BattleCommands::WindowSize_small ? 58 : 64);
+		contents->ClearRect(column);
+		CountRedraw(column);
+
+		for (int i = 0; i < item_max; ++i) {
+			const auto& actor = GetBattler(i);
+			int y = menu_item_height / 8 + i * menu_item_height;
+
+			if (opaque || index != i) {
+				DrawGauge(actor, 202 - 10, y - 2, opaque ? 96 : 255);
 			}
-			else {
-				int y = menu_item_height / 8 + i * menu_item_height;
-
-				if (lcf::Data::battlecommands.battle_type == lcf::rpg::BattleCommands::BattleType_alternative) {
-					// RPG_RT Bug (?): Gauge hidden when selected due to transparency (wrong color when rendering)
-					if (lcf::Data::battlecommands.transparency == lcf::rpg::BattleCommands::Transparency_opaque || (menu_item_height / 8 + index * menu_item_height != y)) {
-						DrawGauge(*actor, 202 - 10, y - 2, lcf::Data::battlecommands.transparency == lcf::rpg::BattleCommands::Transparency_opaque ? 96 : 255);
-					}
-					int hpdigits = (actor->MaxHpValue() >= 1000) ? 4 : 3;
-					int spdigits = (actor->MaxSpValue() >= 1000) ? 4 : 3;
-					DrawActorHp(*actor, 178 - hpdigits * 6 - spdigits * 6, y, hpdigits, true);
-					DrawActorSp(*actor, 220 - spdigits * 6, y, spdigits, false);
-				} else {
-					DrawGauge(*actor, 156, y - 2);
-				}
+			int hpdigits = (actor.MaxHpValue() >= 1000) ? 4 : 3;
+			int spdigits = (actor.MaxSpValue() >= 1000) ? 4 : 3;
+			DrawActorHp(actor, 178 - hpdigits * 6 - spdigits * 6, y, hpdigits, true);
+			DrawActorSp(actor, 220 - spdigits * 6, y, spdigits, false);
+		}
+	} else {
+		BitmapRef system2 = Cache::System2();
+		for (int i = 0; i < item_max; ++i) {
+			const auto& actor = GetBattler(i);
+			const auto key = MakeRegionKey({
+				reinterpret_cast<intptr_t>(system2.get()),
+				GetGaugeState(actor.GetAtbGauge(), actor.GetMaxAtbGauge())
+			});
+			if (!IsRegionDirty(i, key)) {
+				continue;
 			}
+
+			int y = menu_item_height / 8 + i * menu_item_height;
+			DrawGauge(actor, 156, y - 2);
+			CountRedraw(Rect(156, y - 2, 16 + 25 + 16, 16));
 		}
 	}
 }
@@ -78,9 +78,21 @@ protected:
 
 	/**
 	 * Redraws the characters time gauge.
+	 * Only the gauges whose values changed since the last call are redrawn.
 	 */
 	void RefreshGauge();
 
+	/**
+	 * @param i index of the battler
+	 * @return battler displayed in row i
+	 */
+	const Game_Battler& GetBattler(int i) const;
+
+	/**
+	 * @return value that changes when the drawn gauge changes, -1 when no gauge is drawn
+	 */
+	static int GetGaugeState(int cur_value, int max_value);
+
 	void DrawGaugeSystem2(int x, int y, int cur_value, int max_value, int which);
 	void DrawNumberSystem2(int x, int y, int value);
 
@@ -35,6 +35,7 @@ bool Window_GameList::Refresh(FilesystemView filesystem_base, bool show_dotdot)
 	}
 
 	game_directories.clear();
+	scanner.reset();
 
 	this->show_dotdot = show_dotdot;
 
@@ -63,11 +64,19 @@ bool Window_GameList::Refresh(FilesystemView filesystem_base, bool show_dotdot)
 		}
 	}
 
-	// Sort game list in place
-	std::sort(game_directories.begin(), game_directories.end(),
-			  [](const std::string& s, const std::string& s2) {
-				  return strcmp(Utils::LowerCase(s).c_str(), Utils::LowerCase(s2).c_str()) <= 0;
-			  });
+	// Sort game list, case insensitive
+	std::vector<std::pair<std::string, std::string>> sorted;
+	sorted.reserve(game_directories.size());
+	for (auto& dir: game_directories) {
+		sorted.emplace_back(Utils::LowerCase(dir), std::move(dir));
+	}
+	std::sort(sorted.begin(), sorted.end());
+	for (size_t i = 0; i < sorted.size(); ++i) {
+		game_directories[i] = std::move(sorted[i].second);
+	}
+
+	// Validating the entries is slow, they are shown by name until validated
+	scanner = std::make_unique<GameScanner>(base_fs, game_directories);
 
 	if (show_dotdot) {
 		game_directories.insert(game_directories.begin(), "..");
@@ -99,17 +108,46 @@ bool Window_GameList::Refresh(FilesystemView filesystem_base, bool show_dotdot)
 	return true;
 }
 
+void Window_GameList::Update() {
+	Window_Selectable::Update();
+
+	if (!scanner || scanner->IsFinished()) {
+		return;
+	}
+
+	const int offset = show_dotdot ? 1 : 0;
+	for (int index: scanner->Poll()) {
+		if (HasValidEntry()) {
+			DrawItem(index + offset);
+		}
+	}
+}
+
 void Window_GameList::DrawItem(int index) {
 	Rect rect = GetItemRect(index);
 	contents->ClearRect(rect);
 
-	std::string text;
-
-	if (HasValidEntry()) {
-		text = game_directories[index];
+	const int scan_index = index - (show_dotdot ? 1 : 0);
+	if (!scanner || scan_index < 0 || scan_index >= scanner->GetCount()) {
+		contents->TextDraw(rect.x, rect.y, Font::ColorDefault, game_directories[index]);
+		return;
 	}
 
-	contents->TextDraw(rect.x, rect.y, Font::ColorDefault, game_directories[index]);
+	const auto& entry = scanner->GetEntry(scan_index);
+	switch (entry.state) {
+		case GameScanner::State::Pending:
+			contents->TextDraw(rect.x, rect.y, Font::ColorDisabled, entry.name);
+			break;
+		case GameScanner::State::Game:
+			contents->TextDraw(rect.x, rect.y, Font::ColorDefault, entry.title.empty() ? entry.name : entry.title);
+			break;
+		case GameScanner::State::Folder:
+			contents->TextDraw(rect.x, rect.y, Font::ColorDefault, entry.name);
+			break;
+		case GameScanner::State::Invalid:
+			contents->TextDraw(rect.x, rect.y, Font::ColorCritical, entry.name);
+			break;
+	}
 }
 
 void Window_GameList::DrawErrorText(bool show_dotdot) {
@@ -158,3 +196,11 @@ bool Window_GameList::HasValidEntry() {
 std::pair<FilesystemView, std::string> Window_GameList::GetGameFilesystem() const {
 	return { base_fs.Create(game_directories[GetIndex()]), game_directories[GetIndex()] };
 }
+
+GameScanner::State Window_GameList::GetGameState() const {
+	const int scan_index = GetIndex() - (show_dotdot ? 1 : 0);
+	if (!scanner || scan_index < 0 || scan_index >= scanner->GetCount()) {
+		return GameScanner::State::Pending;
+	}
+	return scanner->GetEntry(scan_index).state;
+}
@@ -19,7 +19,9 @@
 #define EP_WINDOW_GAMELIST_H
 
 // Headers
+#include <memory>
 #include <vector>
+#include "game_scanner.h"
 #include "window_help.h"
 #include "window_selectable.h"
 #include "filefinder.h"
@@ -40,6 +42,11 @@ public:
 	 */
 	bool Refresh(FilesystemView filesystem_base, bool show_dotdot);
 
+	/**
+	 * Updates the window and redraws the entries validated by the scanner.
+	 */
+	void Update() override;
+
 	/**
 	 * Draws an item together with the quantity.
 	 *
@@ -59,9 +66,15 @@ public:
 	 */
 	std::pair<FilesystemView, std::string> GetGameFilesystem() const;
 
+	/**
+	 * @return validation state of the selected entry, Pending when not validated yet
+	 */
+	GameScanner::State GetGameState() const;
+
 private:
 	FilesystemView base_fs;
 	std::vector<std::string> game_directories;
+	std::unique_ptr<GameScanner> scanner;
 
 	bool show_dotdot = false;
 };
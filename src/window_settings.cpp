@@ -252,6 +252,7 @@ void Window_Settings::RefreshVideo() {
 	AddOption(cfg.window_zoom, [](){ DisplayUi->ToggleZoom(); });
 	AddOption(cfg.vsync, [](){ DisplayUi->ToggleVsync(); });
 	AddOption(cfg.fps_limit, [this](){ DisplayUi->SetFrameLimit(GetCurrentOption().current_value); });
+	AddOption(cfg.render_threads, [this](){ DisplayUi->SetRenderThreads(GetCurrentOption().current_value); });
 	AddOption(cfg.show_fps, [](){ DisplayUi->ToggleShowFps(); });
 	AddOption(cfg.fps_render_window, [](){ DisplayUi->ToggleShowFpsOnTitle(); });
 	AddOption(cfg.stretch, []() { DisplayUi->ToggleStretch(); });
@@ -280,6 +281,7 @@ void Window_Settings::RefreshEngine() {
 	AddOption(cfg.settings_autosave, [&cfg](){ cfg.settings_autosave.Toggle(); });
 	AddOption(cfg.settings_in_title, [&cfg](){ cfg.settings_in_title.Toggle(); });
 	AddOption(cfg.settings_in_menu, [&cfg](){ cfg.settings_in_menu.Toggle(); });
+	AddOption(cfg.fast_forward_unlimited, [&cfg](){ cfg.fast_forward_unlimited.Toggle(); });
 }
 
 void Window_Settings::RefreshLicense() {
@@ -403,6 +405,9 @@ void Window_Settings::RefreshButtonList() {
 		case 2:
 			buttons = {	Input::DEBUG_MENU, Input::DEBUG_THROUGH, Input::DEBUG_SAVE, Input::DEBUG_ABORT_EVENT,
 				Input::SHOW_LOG };
+#ifdef PLAYER_INSTRUMENTATION_TRACE
+			buttons.push_back(Input::SAVE_TRACE);
+#endif
 			break;
 	}
 
@@ -0,0 +1,106 @@
+#include <vector>
+#include "affine_blit.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("AffineBlit");
+
+namespace {
+
+constexpr int width = 4;
+constexpr int height = 3;
+constexpr int alpha_shift = 24;
+
+std::vector<uint32_t> CreateSource() {
+	std::vector<uint32_t> src(width * height);
+	for (int i = 0; i < width * height; ++i) {
+		src[i] = 0xFF000000 | (i * 0x10101);
+	}
+	return src;
+}
+
+}
+
+TEST_CASE("FromTransform") {
+	AffineBlit::Mapping mapping;
+
+	const int32_t affine[3][3] = { { 1 << 16, 0, 5 << 16 }, { 0, 2 << 16, 0 }, { 0, 0, 1 << 16 } };
+	REQUIRE(AffineBlit::FromTransform(affine, 1, 2, mapping));
+	REQUIRE_EQ(mapping.xx, 1 << 16);
+	REQUIRE_EQ(mapping.tx, 5 << 16);
+	REQUIRE_EQ(mapping.yy, 2 << 16);
+	REQUIRE_EQ(mapping.offset_x, 1);
+	REQUIRE_EQ(mapping.offset_y, 2);
+
+	const int32_t projective[3][3] = { { 1 << 16, 0, 0 }, { 0, 1 << 16, 0 }, { 1, 0, 1 << 16 } };
+	REQUIRE_FALSE(AffineBlit::FromTransform(projective, 0, 0, mapping));
+}
+
+TEST_CASE("Identity") {
+	const auto src = CreateSource();
+	std::vector<uint32_t> dst((width + 2) * height, 0xFFFFFFFF);
+
+	AffineBlit::Blit(dst.data(), (width + 2) * 4, Rect(0, 0, width + 2, height),
+		src.data(), width * 4, width, height, AffineBlit::Mapping(), 255, alpha_shift, AffineBlit::Op::Src);
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			REQUIRE_EQ(dst[y * (width + 2) + x], src[y * width + x]);
+		}
+		// Outside of the source
+		REQUIRE_EQ(dst[y * (width + 2) + width], 0);
+		REQUIRE_EQ(dst[y * (width + 2) + width + 1], 0);
+	}
+}
+
+TEST_CASE("Zoom") {
+	const auto src = CreateSource();
+	std::vector<uint32_t> dst(width * 2 * height * 2);
+
+	AffineBlit::Mapping mapping;
+	mapping.xx = 1 << 15;
+	mapping.yy = 1 << 15;
+
+	AffineBlit::Blit(dst.data(), width * 2 * 4, Rect(0, 0, width * 2, height * 2),
+		src.data(), width * 4, width, height, mapping, 255, alpha_shift, AffineBlit::Op::Over);
+
+	for (int y = 0; y < height * 2; ++y) {
+		for (int x = 0; x < width * 2; ++x) {
+			REQUIRE_EQ(dst[y * width * 2 + x], src[(y / 2) * width + x / 2]);
+		}
+	}
+}
+
+TEST_CASE("Rotate180") {
+	const auto src = CreateSource();
+	std::vector<uint32_t> dst(width * height);
+
+	AffineBlit::Mapping mapping;
+	mapping.xx = -(1 << 16);
+	mapping.yy = -(1 << 16);
+	mapping.tx = width << 16;
+	mapping.ty = height << 16;
+
+	AffineBlit::Blit(dst.data(), width * 4, Rect(0, 0, width, height),
+		src.data(), width * 4, width, height, mapping, 255, alpha_shift, AffineBlit::Op::Src);
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			REQUIRE_EQ(dst[y * width + x], src[(height - 1 - y) * width + (width - 1 - x)]);
+		}
+	}
+}
+
+TEST_CASE("Opacity") {
+	const std::vector<uint32_t> src = { 0xFF804020, 0x00000000, 0x80402010 };
+	std::vector<uint32_t> dst(3, 0xFF000000);
+
+	AffineBlit::Blit(dst.data(), 3 * 4, Rect(0, 0, 3, 1),
+		src.data(), 3 * 4, 3, 1, AffineBlit::Mapping(), 128, alpha_shift, AffineBlit::Op::Over);
+
+	REQUIRE_EQ(dst[0], 0xFF402010);
+	// Transparent pixels keep the destination
+	REQUIRE_EQ(dst[1], 0xFF000000);
+	REQUIRE_EQ(dst[2], 0xFF201008);
+}
+
+TEST_SUITE_END();
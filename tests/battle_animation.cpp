@@ -0,0 +1,81 @@
+#include <cstring>
+#include <lcf/rpg/animation.h>
+#include "battle_animation.h"
+#include "bitmap.h"
+#include "drawable_list.h"
+#include "drawable_mgr.h"
+#include "parallel_renderer.h"
+#include "pixel_format.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("BattleAnimation");
+
+namespace {
+
+class TestAnimation : public BattleAnimation {
+	public:
+		explicit TestAnimation(const lcf::rpg::Animation& anim) : BattleAnimation(anim) {}
+		void Draw(Bitmap& dst) override { DrawAt(dst, 48, 48); }
+	protected:
+		void FlashTargets(int, int, int, int) override {}
+		void ShakeTargets(int, int, int) override {}
+};
+
+/** One frame with two cells of different color and tone */
+lcf::rpg::Animation MakeAnimation() {
+	lcf::rpg::Animation anim;
+	lcf::rpg::AnimationFrame frame;
+	for (int c = 0; c < 2; ++c) {
+		lcf::rpg::AnimationCellData cell;
+		cell.cell_id = c;
+		cell.x = c * 32 - 16;
+		cell.tone_red = 100 + c * 50;
+		frame.cells.push_back(cell);
+	}
+	anim.frames.push_back(frame);
+	return anim;
+}
+
+BitmapRef CreateSheet() {
+	auto sheet = Bitmap::Create(5 * 96, 96, true);
+	sheet->FillRect(Rect(0, 0, 96, 96), Color(255, 0, 0, 255));
+	sheet->FillRect(Rect(96, 0, 96, 96), Color(0, 0, 255, 255));
+	return sheet;
+}
+
+}
+
+TEST_CASE("FlashMatchesSequential") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+	DrawableList list;
+	DrawableMgr::SetLocalList(&list);
+
+	auto anim = MakeAnimation();
+	TestAnimation animation(anim);
+	animation.SetBitmap(CreateSheet());
+	animation.SetFlashEffect(Color(255, 255, 255, 128));
+
+	auto expected = Bitmap::Create(96, 96, false);
+	expected->Fill(Color(0, 0, 0, 255));
+	animation.Draw(*expected);
+
+	for (int threads = 1; threads <= 4; ++threads) {
+		auto actual = Bitmap::Create(96, 96, false);
+		ParallelRenderer renderer(threads);
+		renderer.Begin(*actual);
+		actual->Fill(Color(0, 0, 0, 255));
+		animation.Draw(*actual);
+		renderer.End();
+
+		for (int y = 0; y < actual->height(); ++y) {
+			auto* e = static_cast<uint8_t*>(expected->pixels()) + y * expected->pitch();
+			auto* a = static_cast<uint8_t*>(actual->pixels()) + y * actual->pitch();
+			INFO("threads=", threads, " y=", y);
+			REQUIRE_EQ(std::memcmp(e, a, actual->width() * actual->bpp()), 0);
+		}
+	}
+
+	DrawableMgr::SetLocalList(nullptr);
+}
+
+TEST_SUITE_END();
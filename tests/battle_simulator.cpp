@@ -0,0 +1,87 @@
+#include "test_mock_actor.h"
+#include "battle_simulator.h"
+#include "doctest.h"
+
+static BattleSimulator::Config MakeConfig(int battles, int max_turns) {
+	auto& tp = lcf::Data::troops[0];
+	tp.members.resize(1);
+	tp.members[0].enemy_id = 1;
+
+	BattleSimulator::Config config;
+	config.troop_id = 1;
+	config.party = { 1 };
+	config.battles = battles;
+	config.max_turns = max_turns;
+	config.seed = 1234;
+	return config;
+}
+
+TEST_SUITE_BEGIN("BattleSimulator");
+
+TEST_CASE("Victory") {
+	const MockActor m;
+
+	MakeDBActor(1, 1, 50, 500, 0, 999, 0, 0, 10);
+	MakeDBEnemy(1, 1, 0, 0, 0, 0, 1);
+
+	auto result = BattleSimulator(MakeConfig(20, 10)).Run();
+
+	REQUIRE_EQ(result.battles, 20);
+	REQUIRE_EQ(result.victories, 20);
+	REQUIRE_EQ(result.defeats, 0);
+	REQUIRE_EQ(result.aborted, 0);
+	REQUIRE_GE(result.min_turns, 1);
+	REQUIRE_LE(result.max_turns, 10);
+}
+
+TEST_CASE("WinBeforeFirstAction") {
+	const MockActor m;
+
+	MakeDBActor(1, 1, 50, 500, 0, 999, 0, 0, 10);
+	MakeDBEnemy(1, 1, 0, 0, 0, 0, 1);
+
+	auto config = MakeConfig(4, 10);
+	// Hidden enemies do not count, the battle is won in the first turn
+	lcf::Data::troops[0].members[0].invisible = true;
+
+	auto result = BattleSimulator(config).Run();
+
+	REQUIRE_EQ(result.victories, 4);
+	REQUIRE_EQ(result.actions, 0);
+	REQUIRE_EQ(result.min_turns, 1);
+	REQUIRE_EQ(result.max_turns, 1);
+	REQUIRE_EQ(result.turns, 4);
+}
+
+TEST_CASE("Aborted") {
+	const MockActor m;
+
+	MakeDBActor(1, 1, 50, 500, 0, 0, 0, 0, 10);
+	MakeDBEnemy(1, 9999, 0, 0, 999, 0, 1);
+
+	auto result = BattleSimulator(MakeConfig(5, 3)).Run();
+
+	REQUIRE_EQ(result.battles, 5);
+	REQUIRE_EQ(result.victories, 0);
+	REQUIRE_EQ(result.defeats, 0);
+	REQUIRE_EQ(result.aborted, 5);
+	REQUIRE_EQ(result.min_turns, 3);
+	REQUIRE_EQ(result.max_turns, 3);
+}
+
+TEST_CASE("Deterministic") {
+	const MockActor m;
+
+	MakeDBActor(1, 1, 50, 100, 0, 30, 20, 10, 10);
+	MakeDBEnemy(1, 60, 0, 30, 10, 10, 10);
+
+	auto r1 = BattleSimulator(MakeConfig(10, 50)).Run();
+	auto r2 = BattleSimulator(MakeConfig(10, 50)).Run();
+
+	REQUIRE_EQ(r1.victories, r2.victories);
+	REQUIRE_EQ(r1.defeats, r2.defeats);
+	REQUIRE_EQ(r1.turns, r2.turns);
+	REQUIRE_EQ(r1.actions, r2.actions);
+}
+
+TEST_SUITE_END();
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <vector>
 #include "utils.h"
 #include "drawable_list.h"
 #include "drawable_mgr.h"
@@ -350,4 +352,29 @@ TEST_CASE("TakeFromPred") {
 	REQUIRE(list2.IsDirty());
 }
 
+TEST_CASE("SortStable") {
+	DrawableList default_list;
+	DrawableMgr::SetLocalList(&default_list);
+
+	std::vector<TestSprite> sprites(200);
+	DrawableList list;
+	for (auto& s: sprites) {
+		s.SetZ(std::rand() % 16);
+		list.Append(&s);
+	}
+
+	// Few and many changes, use insertion sort and the full sort
+	for (int changes: { 3, 150 }) {
+		for (int i = 0; i < changes; ++i) {
+			sprites[std::rand() % sprites.size()].SetZ(std::rand() % 16);
+		}
+
+		std::vector<Drawable*> expected(list.begin(), list.end());
+		std::stable_sort(expected.begin(), expected.end(), [](Drawable* l, Drawable* r) { return l->GetZ() < r->GetZ(); });
+
+		list.Sort();
+		REQUIRE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+	}
+}
+
 TEST_SUITE_END();
@@ -204,4 +204,37 @@ TEST_CASE("Incompatible changes") {
 	CHECK(args[0] == "4");
 }
 
+namespace {
+	std::vector<std::string> invoked_args;
+
+	bool RecordArgs(dyn_arg_list args) {
+		invoked_args.assign(args.begin(), args.end());
+		return true;
+	}
+}
+
+TEST_CASE("Invoke resolves references on every call") {
+	const MockActor m;
+
+	std::vector<int32_t> vars = {0, 4, 2};
+	Main_Data::game_variables->SetData(vars);
+	Main_Data::game_variables->SetWarning(0);
+
+	DynRpg::RegisterFunction("record", RecordArgs);
+
+	CHECK(DynRpg::Invoke("@Record V2, \"Text\", AbC"));
+	REQUIRE(invoked_args.size() == 3);
+	CHECK(invoked_args[0] == "4");
+	CHECK(invoked_args[1] == "Text");
+	CHECK(invoked_args[2] == "abc");
+
+	// Same command text: The cached command is used with the new variable value
+	Main_Data::game_variables->Set(2, 1);
+	CHECK(DynRpg::Invoke("@Record V2, \"Text\", AbC"));
+	REQUIRE(invoked_args.size() == 3);
+	CHECK(invoked_args[0] == "1");
+
+	DynRpg::Reset();
+}
+
 TEST_SUITE_END();
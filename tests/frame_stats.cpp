@@ -0,0 +1,46 @@
+#include "frame_stats.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("FrameStats");
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Disabled") {
+	FrameStats::Quit();
+	REQUIRE_FALSE(FrameStats::IsEnabled());
+
+	FrameStats::BeginFrame(Game_Clock::time_point(), 16ms);
+	FrameStats::BeginFrame(Game_Clock::time_point() + 16ms, 16ms);
+	REQUIRE_EQ(FrameStats::GetSummary().frames, 0);
+}
+
+TEST_CASE("Summary") {
+	FrameStats::Init("");
+	REQUIRE(FrameStats::IsEnabled());
+
+	auto t = Game_Clock::time_point();
+	const auto target = std::chrono::duration_cast<Game_Clock::duration>(16ms);
+
+	// 9 frames on time, one frame took three times as long
+	for (int i = 0; i < 11; ++i) {
+		FrameStats::BeginFrame(t, target);
+		FrameStats::SetSteps(i == 10 ? 3 : 1);
+		FrameStats::AddRedrawnPixels(100);
+		FrameStats::AddRedrawnPixels(i == 0 ? 1000 : 0);
+		t += (i == 5) ? 48ms : 16ms;
+	}
+
+	auto summary = FrameStats::GetSummary();
+	REQUIRE_EQ(summary.frames, 10);
+	REQUIRE_EQ(summary.missed, 1);
+	REQUIRE_EQ(summary.steps_min, 1);
+	REQUIRE_EQ(summary.steps_max, 1);
+	REQUIRE_EQ(summary.redrawn_pixels_avg, 200);
+	REQUIRE_EQ(summary.frame_max, 48ms);
+	REQUIRE_EQ(summary.histogram[8], 9);
+	REQUIRE_EQ(summary.histogram[FrameStats::num_buckets - 1], 1);
+
+	FrameStats::Quit();
+}
+
+TEST_SUITE_END();
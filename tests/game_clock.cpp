@@ -0,0 +1,84 @@
+#include <chrono>
+#include "game_clock.h"
+#include "doctest.h"
+
+using namespace std::chrono_literals;
+
+TEST_SUITE_BEGIN("Game_Clock");
+
+namespace {
+
+// Restores the global clock state for the other tests
+struct ClockReset {
+	~ClockReset() {
+		Game_Clock::SetUnlimitedSpeed(Game_Clock::duration::zero());
+		Game_Clock::SetGameSpeedFactor(1.0f);
+		Game_Clock::ResetFrame(Game_Clock::now());
+	}
+};
+
+}
+
+TEST_CASE("SetUnlimitedSpeed") {
+	const ClockReset reset;
+
+	REQUIRE_FALSE(Game_Clock::IsUnlimitedSpeed());
+
+	Game_Clock::SetUnlimitedSpeed(std::chrono::duration_cast<Game_Clock::duration>(100ms));
+	REQUIRE(Game_Clock::IsUnlimitedSpeed());
+
+	Game_Clock::SetUnlimitedSpeed(Game_Clock::duration::zero());
+	REQUIRE_FALSE(Game_Clock::IsUnlimitedSpeed());
+
+	Game_Clock::SetUnlimitedSpeed(std::chrono::duration_cast<Game_Clock::duration>(-100ms));
+	REQUIRE_FALSE(Game_Clock::IsUnlimitedSpeed());
+}
+
+TEST_CASE("LimitedStepsFollowRealTime") {
+	const ClockReset reset;
+
+	const auto t = Game_Clock::now();
+	Game_Clock::ResetFrame(t);
+	Game_Clock::OnNextFrame(t + Game_Clock::GetTargetGameTimeStep() * 5 / 2);
+
+	REQUIRE(Game_Clock::NextGameTimeStep());
+	REQUIRE(Game_Clock::NextGameTimeStep());
+	REQUIRE_FALSE(Game_Clock::NextGameTimeStep());
+}
+
+TEST_CASE("UnlimitedBypassesFrameLimiter") {
+	const ClockReset reset;
+
+	Game_Clock::SetUnlimitedSpeed(std::chrono::duration_cast<Game_Clock::duration>(1h));
+
+	// No real time passed, the steps are not limited by the accumulator
+	const auto t = Game_Clock::now();
+	Game_Clock::ResetFrame(t);
+	Game_Clock::OnNextFrame(t);
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(Game_Clock::NextGameTimeStep());
+	}
+
+	// Speed factor is the simulated time of the previous frame divided by its real time
+	Game_Clock::OnNextFrame(t + Game_Clock::GetTargetGameTimeStep() * 4);
+	REQUIRE_EQ(Game_Clock::GetGameSpeedFactor(), doctest::Approx(25.0f));
+
+	Game_Clock::SetUnlimitedSpeed(Game_Clock::duration::zero());
+	REQUIRE_EQ(Game_Clock::GetGameSpeedFactor(), 1.0f);
+	REQUIRE_FALSE(Game_Clock::NextGameTimeStep());
+}
+
+TEST_CASE("UnlimitedRunsAtLeastOneStep") {
+	const ClockReset reset;
+
+	Game_Clock::SetUnlimitedSpeed(Game_Clock::duration(1));
+
+	// The frame period elapsed already, still one step is run per frame
+	const auto t = Game_Clock::now() - 1s;
+	Game_Clock::ResetFrame(t);
+	Game_Clock::OnNextFrame(t);
+	REQUIRE(Game_Clock::NextGameTimeStep());
+	REQUIRE_FALSE(Game_Clock::NextGameTimeStep());
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,71 @@
+#include "game_pictures.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("Game_Pictures");
+
+namespace {
+
+Game_Pictures::ShowParams MakeShowParams() {
+	Game_Pictures::ShowParams params;
+	// Empty name: No file request, the picture only exists as data
+	params.map_layer = 7;
+	params.battle_layer = 7;
+	return params;
+}
+
+}
+
+TEST_CASE("ErasedPictureFinishesMove") {
+	Game_Pictures pictures;
+	pictures.Show(1500, MakeShowParams());
+
+	Game_Pictures::MoveParams params;
+	params.position_x = 100;
+	params.duration = 1;
+	pictures.Move(1500, params);
+	pictures.Erase(1500);
+
+	auto& pic = pictures.GetPicture(1500);
+	const int time_left = pic.data.time_left;
+	REQUIRE_GT(time_left, 0);
+
+	for (int i = 0; i < time_left; ++i) {
+		REQUIRE(pic.IsActive());
+		pictures.Update(false);
+	}
+
+	REQUIRE_EQ(pic.data.current_x, 100.0);
+	REQUIRE_FALSE(pic.IsActive());
+}
+
+TEST_CASE("MoveReactivates") {
+	Game_Pictures pictures;
+	pictures.Show(3, MakeShowParams());
+	pictures.Erase(3);
+	pictures.Update(false);
+	REQUIRE_FALSE(pictures.GetPicture(3).IsActive());
+
+	Game_Pictures::MoveParams params;
+	params.position_y = 50;
+	params.duration = 1;
+	pictures.Move(3, params);
+
+	auto& pic = pictures.GetPicture(3);
+	while (pic.data.time_left > 0) {
+		pictures.Update(false);
+	}
+	REQUIRE_EQ(pic.data.current_y, 50.0);
+}
+
+TEST_CASE("SaveData") {
+	Game_Pictures pictures;
+	pictures.Show(2, MakeShowParams());
+	pictures.Update(false);
+
+	auto save = pictures.GetSaveData();
+	REQUIRE_GE(save.size(), 2);
+	REQUIRE_EQ(save[1].ID, 2);
+	REQUIRE_EQ(save[1].map_layer, 7);
+}
+
+TEST_SUITE_END();
@@ -15,4 +15,21 @@ TEST_CASE("Message Output") {
 	Graphics::Quit();
 }
 
+TEST_CASE("RateLimit") {
+	const char* callsite = "RateLimit {}";
+	const int dropped = Output::GetDroppedMessages();
+
+	int logged = 0;
+	for (int i = 0; i < 1000; ++i) {
+		logged += Output::CheckRateLimit(callsite) ? 1 : 0;
+	}
+
+	REQUIRE_GT(logged, 0);
+	REQUIRE_LT(logged, 1000);
+	REQUIRE_EQ(Output::GetDroppedMessages() - dropped, 1000 - logged);
+
+	// Not a literal, not limited
+	REQUIRE(Output::CheckRateLimit(std::string("RateLimit {}")));
+}
+
 TEST_SUITE_END();
@@ -0,0 +1,128 @@
+#include <cstring>
+#include "parallel_renderer.h"
+#include "bitmap.h"
+#include "pixel_format.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("ParallelRenderer");
+
+namespace {
+
+constexpr int width = 64;
+constexpr int height = 45;
+
+BitmapRef CreateSource() {
+	auto src = Bitmap::Create(16, 16, true);
+	src->FillRect(Rect(0, 0, 8, 8), Color(255, 0, 0, 255));
+	src->FillRect(Rect(8, 0, 8, 8), Color(0, 255, 0, 128));
+	src->FillRect(Rect(0, 8, 8, 8), Color(0, 0, 255, 255));
+	src->FillRect(Rect(8, 8, 8, 8), Color(255, 255, 255, 64));
+	return src;
+}
+
+void Draw(Bitmap& dst, Bitmap const& src) {
+	dst.Fill(Color(20, 40, 60, 255));
+	dst.Blit(-4, 10, src, src.GetRect(), Opacity::Opaque());
+	dst.Blit(30, 3, src, src.GetRect(), 128);
+	dst.FillRect(Rect(5, 20, 40, 3), Color(200, 100, 0, 200));
+	dst.TiledBlit(Rect(0, 0, 16, 16), src, Rect(40, 0, 24, 45), 255);
+	dst.StretchBlit(Rect(2, 30, 40, 12), src, src.GetRect(), 255);
+	dst.RotateZoomOpacityBlit(32, 22, 8, 8, src, src.GetRect(), 0.5, 1.5, 1.5, 200);
+	dst.FlipBlit(10, 5, src, Rect(0, 0, 16, 12), true, false, 255);
+	// Reads from the target, executed as barrier
+	dst.ToneBlit(0, 0, dst, dst.GetRect(), Tone(200, 128, 100, 64), Opacity::Opaque());
+	dst.WaverBlit(0, 12, 1.0, 1.0, src, src.GetRect(), 2, 0.3, 255);
+	dst.ClearRect(Rect(60, 40, 4, 5));
+}
+
+}
+
+TEST_CASE("MatchesSequential") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	auto src = CreateSource();
+
+	for (int threads = 1; threads <= 5; ++threads) {
+		auto expected = Bitmap::Create(width, height, false);
+		Draw(*expected, *src);
+
+		auto actual = Bitmap::Create(width, height, false);
+		ParallelRenderer renderer(threads);
+		renderer.Begin(*actual);
+		REQUIRE(renderer.IsActive());
+		Draw(*actual, *src);
+		renderer.End();
+		REQUIRE_FALSE(renderer.IsActive());
+
+		for (int y = 0; y < height; ++y) {
+			auto* e = static_cast<uint8_t*>(expected->pixels()) + y * expected->pitch();
+			auto* a = static_cast<uint8_t*>(actual->pixels()) + y * actual->pitch();
+			INFO("threads=", threads, " y=", y);
+			REQUIRE_EQ(std::memcmp(e, a, width * expected->bpp()), 0);
+		}
+	}
+}
+
+TEST_CASE("RecordingIsDeferred") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	auto dst = Bitmap::Create(8, 8, false);
+	dst->Fill(Color(0, 0, 0, 255));
+	const auto before = *static_cast<uint32_t*>(dst->pixels());
+
+	ParallelRenderer renderer(2);
+	renderer.Begin(*dst);
+	dst->Fill(Color(255, 255, 255, 255));
+	REQUIRE_EQ(*static_cast<uint32_t*>(dst->pixels()), before);
+
+	renderer.Flush();
+	REQUIRE_NE(*static_cast<uint32_t*>(dst->pixels()), before);
+	renderer.End();
+}
+
+TEST_CASE("SourceModifiedBeforeFlush") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	auto src = Bitmap::Create(8, 8, false);
+	src->Fill(Color(255, 0, 0, 255));
+	const auto red = *static_cast<uint32_t*>(src->pixels());
+
+	auto dst = Bitmap::Create(8, 8, false);
+	ParallelRenderer renderer(2);
+	renderer.Begin(*dst);
+	dst->Blit(0, 0, *src, src->GetRect(), Opacity::Opaque());
+	REQUIRE_NE(*static_cast<uint32_t*>(dst->pixels()), red);
+
+	// Flushes the pending blit
+	src->Fill(Color(0, 0, 255, 255));
+	REQUIRE_EQ(*static_cast<uint32_t*>(dst->pixels()), red);
+
+	dst->Blit(0, 0, *src, src->GetRect(), Opacity::Opaque());
+	src.reset();
+	REQUIRE_NE(*static_cast<uint32_t*>(dst->pixels()), red);
+	renderer.End();
+}
+
+TEST_CASE("ClipRect") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	auto dst = Bitmap::Create(8, 8, false);
+	dst->Fill(Color(0, 0, 0, 255));
+	const auto black = *static_cast<uint32_t*>(dst->pixels());
+
+	dst->SetClipRect(Rect(0, 4, 8, 4));
+	REQUIRE_EQ(dst->GetClipRect(), Rect(0, 4, 8, 4));
+	dst->Fill(Color(255, 255, 255, 255));
+
+	auto pixel = [&](int x, int y) {
+		return static_cast<uint32_t*>(dst->pixels())[y * dst->pitch() / 4 + x];
+	};
+	REQUIRE_EQ(pixel(3, 3), black);
+	REQUIRE_NE(pixel(3, 4), black);
+
+	dst->SetClipRect(Rect());
+	dst->Fill(Color(255, 255, 255, 255));
+	REQUIRE_NE(pixel(3, 3), black);
+}
+
+TEST_SUITE_END();
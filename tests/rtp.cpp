@@ -33,6 +33,38 @@ TEST_CASE("RTP 2003: lookup table is correct") {
 	}
 }
 
+template <typename T, typename S>
+static void check_sorted(T rtp_table, S sorted, const char* const categories[], const int categories_idx[], int num_rtps) {
+	for (int i = 0; categories[i] != nullptr; ++i) {
+		for (int j = 0; j < num_rtps; ++j) {
+			for (int k = categories_idx[i]; k < categories_idx[i + 1]; ++k) {
+				int row = sorted[k][j];
+				REQUIRE_GE(row, categories_idx[i]);
+				REQUIRE_LT(row, categories_idx[i + 1]);
+
+				if (k + 1 == categories_idx[i + 1]) {
+					continue;
+				}
+				const char* name = rtp_table[row][j + 1];
+				const char* next_name = rtp_table[sorted[k + 1][j]][j + 1];
+				if (name == nullptr) {
+					REQUIRE(next_name == nullptr);
+				} else if (next_name != nullptr) {
+					REQUIRE_LE(StringView(name), StringView(next_name));
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("RTP 2000: sorted index is correct") {
+	check_sorted(RTP::rtp_table_2k, RTP::rtp_table_2k_sorted, RTP::rtp_table_2k_categories, RTP::rtp_table_2k_categories_idx, RTP::num_2k_rtps);
+}
+
+TEST_CASE("RTP 2003: sorted index is correct") {
+	check_sorted(RTP::rtp_table_2k3, RTP::rtp_table_2k3_sorted, RTP::rtp_table_2k3_categories, RTP::rtp_table_2k3_categories_idx, RTP::num_2k3_rtps);
+}
+
 TEST_CASE("RTP 2000: Detection") {
 	Player::escape_symbol = "\\";
 
@@ -0,0 +1,94 @@
+#include "tilemap_layer.h"
+#include "bitmap.h"
+#include "map_data.h"
+#include "pixel_format.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("TilemapAutotiles");
+
+namespace {
+
+BitmapRef CreateChipset() {
+	// Every quarter of a tile gets a unique color
+	auto chipset = Bitmap::Create(480, 256, false);
+	for (int y = 0; y < 256 / (TILE_SIZE / 2); ++y) {
+		for (int x = 0; x < 480 / (TILE_SIZE / 2); ++x) {
+			chipset->FillRect(Rect(x * TILE_SIZE / 2, y * TILE_SIZE / 2, TILE_SIZE / 2, TILE_SIZE / 2), Color(x * 4, y * 4, 0, 255));
+		}
+	}
+	return chipset;
+}
+
+}
+
+TEST_CASE("Lazy") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	TilemapAutotiles autotiles(CreateChipset());
+	REQUIRE_FALSE(autotiles.GetBitmapAB());
+	REQUIRE_FALSE(autotiles.GetBitmapD());
+	REQUIRE_FALSE(autotiles.HasAB(0, 0));
+
+	auto pos = autotiles.GetAB(0, 0);
+	REQUIRE(pos.valid);
+	REQUIRE(autotiles.HasAB(0, 0));
+	REQUIRE_FALSE(autotiles.HasAB(0, 1));
+	REQUIRE(autotiles.GetBitmapAB());
+	REQUIRE_FALSE(autotiles.GetBitmapD());
+}
+
+TEST_CASE("Invalid") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	TilemapAutotiles autotiles(CreateChipset());
+	REQUIRE_FALSE(TilemapAutotiles::IsValidAB(47));
+	REQUIRE_FALSE(TilemapAutotiles::IsValidD(BLOCK_E));
+	REQUIRE_FALSE(autotiles.GetAB(47, 0).valid);
+	REQUIRE_FALSE(autotiles.GetD(BLOCK_E).valid);
+}
+
+TEST_CASE("SharedQuarters") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	TilemapAutotiles autotiles(CreateChipset());
+
+	// The last two D subtiles use the same quarters as the first one
+	auto pos1 = autotiles.GetD(BLOCK_D);
+	auto pos2 = autotiles.GetD(BLOCK_D + 47);
+	REQUIRE(pos1.valid);
+	REQUIRE(pos2.valid);
+	REQUIRE_EQ(pos1.x, pos2.x);
+	REQUIRE_EQ(pos1.y, pos2.y);
+}
+
+TEST_CASE("Grow") {
+	Bitmap::SetFormat(format_R8G8B8A8_a().format());
+
+	auto chipset = CreateChipset();
+	TilemapAutotiles autotiles(chipset);
+
+	for (int id = BLOCK_D; id < BLOCK_E; ++id) {
+		if (TilemapAutotiles::IsValidD(id)) {
+			autotiles.GetD(id);
+		}
+	}
+
+	// Contents survive growing the bitmap
+	for (int id = BLOCK_D; id < BLOCK_E; ++id) {
+		if (!TilemapAutotiles::IsValidD(id)) {
+			continue;
+		}
+		auto pos = autotiles.GetD(id);
+		REQUIRE(pos.valid);
+		REQUIRE_EQ(autotiles.GetBitmapD()->GetTileOpacity(pos.x, pos.y), ImageOpacity::Opaque);
+	}
+
+	// Subtile 0 of D1 uses quarters of the tile at 1,10 (in quarters 2,20)
+	auto pos = autotiles.GetD(BLOCK_D);
+	auto& bitmap = *autotiles.GetBitmapD();
+	REQUIRE_EQ(bitmap.GetColorAt(pos.x * TILE_SIZE, pos.y * TILE_SIZE), chipset->GetColorAt(TILE_SIZE, 10 * TILE_SIZE));
+	REQUIRE_EQ(bitmap.GetColorAt(pos.x * TILE_SIZE + TILE_SIZE - 1, pos.y * TILE_SIZE + TILE_SIZE - 1),
+			chipset->GetColorAt(2 * TILE_SIZE - 1, 11 * TILE_SIZE - 1));
+}
+
+TEST_SUITE_END();
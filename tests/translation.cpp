@@ -0,0 +1,79 @@
+#include <sstream>
+#include "translation.h"
+#include "doctest.h"
+
+TEST_SUITE_BEGIN("Translation");
+
+namespace {
+
+Dictionary CreateDictionary() {
+	std::stringstream po;
+	po << "msgid \"\"\n"
+		"msgstr \"\"\n"
+		"\n"
+		"msgctxt \"actors.name\"\n"
+		"msgid \"Alex\"\n"
+		"msgstr \"Alexis\"\n"
+		"\n"
+		"msgid \"Hello\\n\"\n"
+		"\"World\"\n"
+		"msgstr \"Xin chào\\n\"\n"
+		"\"Thế giới\"\n"
+		"\n"
+		"msgid \"Twice\"\n"
+		"msgstr \"First\"\n"
+		"\n"
+		"msgid \"Twice\"\n"
+		"msgstr \"Second\"\n"
+		"\n"
+		"msgid \"Untranslated\"\n"
+		"msgstr \"\"\n";
+
+	Dictionary dict;
+	Dictionary::FromPo(dict, po);
+	return dict;
+}
+
+}
+
+TEST_CASE("Lookup") {
+	auto dict = CreateDictionary();
+	REQUIRE_EQ(dict.GetCount(), 3);
+
+	std::string str = "Alex";
+	REQUIRE_FALSE(dict.TranslateString("", str));
+	REQUIRE(dict.TranslateString("actors.name", str));
+	REQUIRE_EQ(str, "Alexis");
+
+	str = "Hello\nWorld";
+	REQUIRE(dict.TranslateString("", str));
+	REQUIRE_EQ(str, "Xin chào\nThế giới");
+
+	str = "Twice";
+	REQUIRE(dict.TranslateString("", str));
+	REQUIRE_EQ(str, "Second");
+
+	str = "Untranslated";
+	REQUIRE_FALSE(dict.TranslateString("", str));
+	REQUIRE_EQ(str, "Untranslated");
+}
+
+TEST_CASE("Binary") {
+	auto dict = CreateDictionary();
+	auto data = dict.ToBinary();
+
+	Dictionary loaded;
+	REQUIRE(Dictionary::FromBinary(loaded, data));
+	REQUIRE_EQ(loaded.GetCount(), dict.GetCount());
+
+	std::string str = "Alex";
+	REQUIRE(loaded.TranslateString("actors.name", str));
+	REQUIRE_EQ(str, "Alexis");
+
+	data.pop_back();
+	Dictionary truncated;
+	REQUIRE_FALSE(Dictionary::FromBinary(truncated, data));
+	REQUIRE_EQ(truncated.GetCount(), 0);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,209 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Headless battle simulator.
+ *
+ * Loads the database of a game and simulates battles between the party and a
+ * troop without rendering. Both sides are controlled by the battle AI.
+ *
+ * The engine state is global, so every process runs a single simulation.
+ * To use multiple cores launch several processes with different --seed values
+ * and sum up the results.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <fmt/core.h>
+#include <lcf/data.h>
+#include <lcf/ldb/reader.h>
+#include <lcf/reader_util.h>
+
+#include "battle_simulator.h"
+#include "cmdline_parser.h"
+#include "filefinder.h"
+#include "output.h"
+#include "player.h"
+
+static void PrintUsage() {
+	std::cout <<
+R"(Usage: battle_simulator [OPTION]...
+Simulates battles of an RPG Maker 2000/2003 game without rendering.
+
+Options:
+ --autobattle-algo A  AutoBattle algorithm used by the party.
+ --battles N          Number of battles to simulate. The default is 1000.
+ --encoding N         Encoding of the database. Autodetected when unspecified.
+ --enemyai-algo A     EnemyAI algorithm used by the troop.
+ --max-turns N        Abort battles after N turns. The default is 100.
+ --party A B...       Use the actors with IDs A, B, ... instead of the initial
+                      party.
+ --project-path PATH  Load the game in PATH instead of the working directory.
+ --seed N             Seeds the random number generator with N.
+ --troop N            Troop to fight against. The default is 1.
+ -h, --help           Display this help and exit.
+
+The simulation is single threaded. Run several instances with different seeds
+to make use of multiple cores.
+)";
+}
+
+static bool LoadDatabase(const FilesystemView& fs, std::string encoding) {
+	if (encoding.empty()) {
+		auto ini_stream = fs.OpenInputStream(fs.FindFile(INI_NAME));
+		if (ini_stream) {
+			encoding = lcf::ReaderUtil::GetEncoding(ini_stream);
+		}
+	}
+
+	auto ldb_stream = fs.OpenInputStream(fs.FindFile(DATABASE_NAME));
+	if (!ldb_stream) {
+		std::cerr << "Cannot open " << DATABASE_NAME << "\n";
+		return false;
+	}
+
+	if (encoding.empty() || encoding == "auto") {
+		auto db = lcf::LDB_Reader::Load(ldb_stream);
+		if (db) {
+			auto encodings = lcf::ReaderUtil::DetectEncodings(*db);
+			if (!encodings.empty()) {
+				encoding = encodings.front();
+			}
+		}
+		ldb_stream = fs.OpenInputStream(fs.FindFile(DATABASE_NAME));
+	}
+	if (encoding.empty()) {
+		encoding = lcf::ReaderUtil::GetLocaleEncoding();
+	}
+
+	auto db = lcf::LDB_Reader::Load(ldb_stream, encoding);
+	if (!db) {
+		std::cerr << lcf::LcfReader::GetError() << "\n";
+		return false;
+	}
+	lcf::Data::data = std::move(*db);
+
+	if (lcf::Data::system.ldb_id == 2003) {
+		Player::game_config.engine = Player::EngineRpg2k3;
+	} else {
+		Player::game_config.engine = Player::EngineRpg2k;
+	}
+	if (lcf::Data::data.version >= 1) {
+		Player::game_config.engine |= Player::EngineEnglish | Player::EngineMajorUpdated;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[]) {
+	std::vector<std::string> args(argv + 1, argv + argc);
+	CmdlineParser cp(args);
+
+	BattleSimulator::Config config;
+	std::string project_path = ".";
+	std::string encoding;
+
+	while (!cp.Done()) {
+		CmdlineArg arg;
+		long li_value = 0;
+
+		if (cp.ParseNext(arg, 0, "--help", 'h')) {
+			PrintUsage();
+			return EXIT_SUCCESS;
+		}
+		if (cp.ParseNext(arg, 1, "--autobattle-algo")) {
+			arg.ParseValue(0, config.autobattle_algo);
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--battles")) {
+			if (arg.ParseValue(0, li_value)) {
+				config.battles = li_value;
+			}
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--encoding")) {
+			arg.ParseValue(0, encoding);
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--enemyai-algo")) {
+			arg.ParseValue(0, config.enemyai_algo);
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--max-turns")) {
+			if (arg.ParseValue(0, li_value)) {
+				config.max_turns = li_value;
+			}
+			continue;
+		}
+		if (cp.ParseNext(arg, 8, "--party")) {
+			for (int i = 0; i < arg.NumValues(); ++i) {
+				if (arg.ParseValue(i, li_value)) {
+					config.party.push_back(li_value);
+				}
+			}
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--project-path")) {
+			arg.ParseValue(0, project_path);
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--seed")) {
+			if (arg.ParseValue(0, li_value)) {
+				config.seed = li_value;
+			}
+			continue;
+		}
+		if (cp.ParseNext(arg, 1, "--troop")) {
+			if (arg.ParseValue(0, li_value)) {
+				config.troop_id = li_value;
+			}
+			continue;
+		}
+
+		cp.SkipNext();
+	}
+
+	Output::SetLogLevel(LogLevel::Warning);
+
+	auto fs = FileFinder::Root().Create(FileFinder::MakeCanonical(project_path, 0));
+	if (!fs || !FileFinder::IsValidProject(fs)) {
+		std::cerr << project_path << " is not a valid RPG Maker 2000/2003 project\n";
+		return EXIT_FAILURE;
+	}
+	FileFinder::SetGameFilesystem(fs);
+
+	if (!LoadDatabase(fs, encoding)) {
+		return EXIT_FAILURE;
+	}
+
+	const auto result = BattleSimulator(config).Run();
+	if (result.battles == 0) {
+		return EXIT_FAILURE;
+	}
+
+	auto percent = [&](int n) { return 100.0 * n / result.battles; };
+
+	std::cout << fmt::format("Troop {}: {} battles in {:.3f}s ({:.1f} battles/s)\n",
+			config.troop_id, result.battles, std::chrono::duration<double>(result.elapsed).count(), result.GetBattlesPerSecond());
+	std::cout << fmt::format("Victories: {} ({:.1f}%) Defeats: {} ({:.1f}%) Aborted: {} ({:.1f}%)\n",
+			result.victories, percent(result.victories), result.defeats, percent(result.defeats), result.aborted, percent(result.aborted));
+	std::cout << fmt::format("Turns: avg {:.2f} min {} max {}\n",
+			result.GetAverageTurns(), result.min_turns, result.max_turns);
+	std::cout << fmt::format("Actions: {}\n", result.actions);
+
+	return EXIT_SUCCESS;
+}